@@ -0,0 +1,106 @@
+/*
+  BlockBuffer.h
+
+  Double-buffered output for block processing. The sample rate ISR plays
+  out one half of the buffer a sample at a time while the main loop renders
+  the next block into the other half with the DSP classes' render_block()
+  and process_block() methods.
+
+  Copyright (C) 2021 Jeff Gregorio
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef BLOCKBUFFER_H
+#define BLOCKBUFFER_H
+
+/*
+ * Unsigned 16-bit double buffer with N samples per half
+ * - Output latency is between N and 2N samples
+ *
+ *   DoubleBuffer16<32> out;
+ *
+ *   void loop() {
+ *     uint16_t *block = out.refill();
+ *     if (block) {
+ *       osc.render_block(block, 32);
+ *       out.done();
+ *     }
+ *   }
+ *
+ *   ISR(ADC_vect) {
+ *     timer1.pwm_write_a(out.next() >> 6);
+ *   }
+ */
+template <uint8_t N>
+struct DoubleBuffer16 {
+
+  /*
+   * Constructor
+   */
+  DoubleBuffer16() : buf(), ready(), idx(0), play(0), fill(1), 
+    underruns(0) {
+    ; // Do nothing
+  }
+
+  /*
+   * Get the next output sample. Call once per sample from the ISR.
+   * - Swaps halves at the end of each block, marking the half just played
+   *   as consumed and counting an underrun if the half it swaps to hasn't 
+   *   been refilled since it last played (it's played again regardless)
+   */
+  uint16_t next() {
+    uint16_t s = buf[play][idx];
+    if (++idx == N) {
+      idx = 0;
+      ready[play] = 0;
+      play ^= 1;
+      if (!ready[play])
+        underruns++;
+    }
+    return s;
+  }
+
+  /*
+   * Get the half to render into, or null if it's not yet been played out.
+   * Call from the main loop, followed by done() once the block is rendered.
+   * - The ISR only clears the ready flag of the half it leaves, and the 
+   *   main loop only sets the flag of the half refill() returned, so no 
+   *   interrupt masking is needed. If the ISR swaps onto the half being 
+   *   rendered, the underrun is counted there and refill() then returns 
+   *   the other half once done() is called.
+   */
+  uint16_t *refill() {
+    uint8_t h = play ^ 1;
+    if (ready[h])
+      return 0;
+    fill = h;
+    return buf[h];
+  }
+  void done() {
+    ready[fill] = 1;
+  }
+
+  /*
+   * Data
+   */
+  uint16_t buf[2][N];         // Halves
+  volatile uint8_t ready[2];  // Half refilled and not yet played
+  volatile uint8_t idx;       // Read position in the half being played
+  volatile uint8_t play;      // Half being played
+  uint8_t fill;               // Half returned by the last refill()
+  volatile uint8_t underruns; // Blocks not refilled in time
+};
+
+#endif
@@ -0,0 +1,313 @@
+/*
+  ControlRate.h
+
+  Control rate decimation and parameter smoothing. Parameters that change
+  far slower than the sample rate (knobs, table lookups, coefficient 
+  updates) are computed once every N samples by ControlRate, and Ramp16 
+  interpolates them linearly in between so the steps aren't heard as zipper
+  noise. ControlRamp16 does both for one parameter with a single counter.
+  Smoother16 slews any parameter toward a target set at any rate.
+
+  Copyright (C) 2021 Jeff Gregorio
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef CONTROLRATE_H
+#define CONTROLRATE_H
+
+/*
+ * Scheduler calling a parameter update function every N samples
+ * - Call tick() once per sample from the ISR. Returns true on the samples
+ *   the update runs, so the update can also be written inline:
+ *
+ *     ControlRate<32> ctl;
+ *
+ *     ISR(ADC_vect) {
+ *       if (ctl.tick())
+ *         cutoff.set(coeff_table.lookup_scale(adc.results[1]));
+ *       lpf.coeff = cutoff.render();
+ *       ...
+ *     }
+ */
+template <uint8_t N>
+struct ControlRate {
+
+  /*
+   * Constructor with optional update function
+   */
+  ControlRate(void (*update)() = 0) : update(update), count(0) {
+    ; // Do nothing
+  }
+
+  /*
+   * Count a sample, running the update every N samples (starting with the
+   * first)
+   */
+  bool tick() {
+    if (count) {
+      count--;
+      return false;
+    }
+    count = N - 1;
+    if (update)
+      update();
+    return true;
+  }
+
+  /*
+   * Data
+   */
+  void (*update)();   // Parameter update function, or null
+  uint8_t count;      // Samples until next update
+};
+
+/*
+ * Linear ramp over N samples from the current value to a target, e.g. for
+ * parameters updated by ControlRate<N>
+ * - set() costs one multiply, each sample an add and a decrement while
+ *   ramping. Setting the value already reached leaves the ramp idle, so
+ *   render() only returns the held value.
+ * - The target is reached exactly on the Nth sample
+ */
+template <uint8_t N>
+struct Ramp16 {
+
+  static_assert(N >= 2, "Ramp16 needs N >= 2");
+
+  /*
+   * Constructor with optional initial value
+   */
+  Ramp16(uint16_t value = 0) : acc((uint32_t)value << 16), step(0),
+    target(value), value(value), count(0) {
+    ; // Do nothing
+  }
+
+  /*
+   * Ramp to a new target over the next N samples
+   */
+  void set(uint16_t t) {
+    if (!count && t == value)   // Already there, stay idle
+      return;
+    target = t;
+    step = ((int32_t)t - value) * (int32_t)(0x10000L / N);
+    count = N;
+  }
+
+  /*
+   * Render the next interpolated value
+   */
+  uint16_t render() {
+    if (count) {
+      if (--count)
+        acc += step;
+      else
+        acc = (uint32_t)target << 16;
+      value = acc >> 16;
+    }
+    return value;
+  }
+
+  /*
+   * Render a block of n interpolated values
+   */
+  void render_block(uint16_t *out, uint8_t n) {
+    for (uint8_t i = 0; i < n; i++)
+      out[i] = render();
+  }
+
+  /*
+   * Data
+   */
+  uint32_t acc;       // Value in UQ16.16
+  int32_t step;       // Increment per sample in UQ16.16
+  uint16_t target;    // Value at the end of the ramp
+  uint16_t value;     // Current output
+  uint8_t count;      // Samples until target
+};
+
+/*
+ * ControlRate<N> and Ramp16<N> sharing one counter, for a single parameter
+ * updated at control rate
+ * - tick() returns true every N samples (starting with the first), when 
+ *   set() should be called with the new target. In between, the counter's
+ *   sign tells a ramp from a held value, so a held value costs one count 
+ *   test and a decrement per sample, and a ramp adds a 32-bit add.
+ *
+ *     ControlRamp16<32> cutoff;
+ *
+ *     ISR(ADC_vect) {
+ *       if (cutoff.tick())
+ *         cutoff.set(coeff_table.lookup_scale(adc.results[1]));
+ *       lpf.coeff = cutoff.value;
+ *       ...
+ *     }
+ *
+ * - The previous target is reached exactly on the sample set() is called,
+ *   so the ramp lags the control input by N samples, one more than
+ *   ControlRate with Ramp16
+ * - AVR, est. from loads, stores, and branches, not measured: ~11 cycles
+ *   per sample while held and ~40 while ramping, against ~16 and ~50 for 
+ *   ControlRate::tick() with Ramp16::render(), and ~40 for a per-sample 
+ *   lookup_scale(). Host timings don't show the gain (see README 5.11).
+ */
+template <uint8_t N>
+struct ControlRamp16 {
+
+  static_assert(N >= 2 && N <= 128, "ControlRamp16 needs 2 <= N <= 128");
+
+  /*
+   * Constructor with optional initial value
+   */
+  ControlRamp16(uint16_t value = 0) : acc((uint32_t)value << 16), step(0),
+    target(value), value(value), count(0) {
+    ; // Do nothing
+  }
+
+  /*
+   * Count a sample, advancing the ramp. Returns true when set() is due.
+   */
+  bool tick() {
+    if (count < 0) {            // Holding
+      count++;
+      return false;
+    }
+    if (count) {                // Ramping
+      count--;
+      acc += step;
+      value = acc >> 16;
+      return false;
+    }
+    count = N - 1;
+    return true;
+  }
+
+  /*
+   * Ramp from the previous target to t over the next N samples, or hold 
+   * if t is unchanged. Call when tick() returns true.
+   */
+  void set(uint16_t t) {
+    value = target;
+    if (t == target) {
+      count = -count;
+      return;
+    }
+    acc = (uint32_t)target << 16;
+    target = t;
+    step = ((int32_t)t - value) * (int32_t)(0x10000L / N);
+  }
+
+  /*
+   * Data
+   */
+  uint32_t acc;       // Value in UQ16.16
+  int32_t step;       // Increment per sample in UQ16.16
+  uint16_t target;    // Value at the end of the ramp
+  uint16_t value;     // Current output
+  int8_t count;       // Samples until next update, negative while holding
+};
+
+/*
+ * Parameter smoother (de-zipper), writing a UQ16 value that follows a
+ * target by one-pole or linear slew
+ * - Optionally writes each value to a field of another object, e.g. 
+ *     Smoother16 cutoff(&lpf.coeff);
+ *   then cutoff.set(x) from the control input and cutoff.render() once per
+ *   sample
+ * - SmoothOnePole: rate is the UQ16 coefficient of a one-pole low pass, as 
+ *   in OnePole16, in (0, 0x7FFF]. The time constant is about 0x10000/rate 
+ *   samples. The state is kept in UQ16.16, as OnePole16_LF keeps Q32, so 
+ *   slow rates still reach the target exactly.
+ * - SmoothLinear: rate is the step per sample in UQ8.8
+ * - Once the value reaches the target, settled is set and render() does no
+ *   work until the next set() with a different target
+ */
+struct Smoother16 {
+
+  /*
+   * Enumeration of slew modes
+   */
+  enum {
+    SmoothOnePole = 0,
+    SmoothLinear
+  };
+
+  /*
+   * Constructor with optional destination field, mode, and rate
+   */
+  Smoother16(uint16_t *dest = 0, uint8_t mode = SmoothOnePole, 
+    uint16_t rate = 0x0100) : dest(dest), acc(0), target(0), value(0), 
+    rate(rate), mode(mode), settled(true) {
+    ; // Do nothing
+  }
+
+  /*
+   * Set a new target
+   */
+  void set(uint16_t t) {
+    if (t != target) {
+      target = t;
+      settled = false;
+    }
+  }
+
+  /*
+   * Jump to a value without slewing
+   */
+  void reset(uint16_t v) {
+    target = value = v;
+    acc = (uint32_t)v << 16;
+    settled = true;
+    if (dest)
+      *dest = v;
+  }
+
+  /*
+   * Render the next value, writing it to the destination field if any
+   */
+  uint16_t render() {
+    if (settled)
+      return value;
+    if (mode == SmoothOnePole) {
+      acc += (int32_t)((int32_t)target - value) * rate;
+    } else {
+      uint32_t t = (uint32_t)target << 16, step = (uint32_t)rate << 8;
+      if (acc < t)
+        acc = t - acc > step ? acc + step : t;
+      else
+        acc = acc - t > step ? acc - step : t;
+    }
+    value = acc >> 16;
+    if (value == target) {
+      acc = (uint32_t)target << 16;
+      settled = true;
+    }
+    if (dest)
+      *dest = value;
+    return value;
+  }
+
+  /*
+   * Data
+   */
+  uint16_t *dest;     // Field to write, or null
+  uint32_t acc;       // Value in UQ16.16
+  uint16_t target;    // Value to slew to
+  uint16_t value;     // Current output
+  uint16_t rate;      // Coefficient (UQ16) or step per sample (UQ8.8)
+  uint8_t mode;       // SmoothOnePole or SmoothLinear
+  bool settled;       // Value has reached target
+};
+
+#endif
@@ -0,0 +1,175 @@
+/*
+  Dynamics.h
+
+  Dynamics processors, Q16 (signed) fixed point. Levels and gains are
+  computed in the log2 domain with tables in program memory generated by
+  tablegen.py.
+
+  Copyright (C) 2021 Jeff Gregorio
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef DYNAMICS_H
+#define DYNAMICS_H
+
+#include "FixedPoint.h"
+#include "IIR.h"
+
+/*
+ * Level in dB to log2 units in Q5.11 (2048 per octave, ~6.02dB), e.g. for
+ * Compressor16 threshold and makeup. Evaluated at compile time for constant
+ * arguments.
+ */
+static constexpr int16_t comp_db(float db) {
+  return db * (2048 / 6.0206f) + (db < 0 ? -0.5f : 0.5f);
+}
+
+/*
+ * Compression ratio R:1 to the UQ16 slope 1 - 1/R used by Compressor16
+ * (0 for 1:1, 0xFFFF for limiting)
+ */
+static constexpr uint16_t comp_ratio(float r) {
+  return r <= 1 ? 0 : (1 - 1 / r) * 0xFFFF + 0.5f;
+}
+
+/*
+ * Feed-forward compressor/limiter with threshold, ratio, and makeup gain
+ * - Each sample the input's peak is tracked (a compare) and the current gain
+ *   applied (one qmul16). Every N samples the gain is recomputed from the
+ *   block's peak:
+ *     - level = log2(peak), using the 256 entry log2 table (tablegen.py log2)
+ *     - reduction = -slope * (level - threshold) above the threshold
+ *     - reduction smoothed by a OnePole16_LF with attack and release
+ *       coefficients, so slow releases still return to exactly 0dB
+ *     - gain = exp2(reduction + makeup), using the 256 entry exp2 table
+ *       (tablegen.py exp2)
+ * - Levels, threshold, and makeup are log2 units in Q5.11 relative to full
+ *   scale (see comp_db()). Level resolution is ~0.03dB.
+ * - attack and release are UQ16 coefficients applied once per N samples, so
+ *   time constants are about N * 0x10000/coeff samples
+ * - Net gain above unity (makeup exceeding the reduction) adds a saturating
+ *   left shift per sample
+ * - The gain follows the detector by up to N samples, so transients shorter
+ *   than that pass before reduction; it's not a brickwall limiter
+ * - Est. ~30 cycles per sample on AVR plus ~400 per update, not measured
+ */
+template <uint8_t N>
+struct Compressor16 {
+
+  static_assert(N >= 1, "Compressor16 needs N >= 1");
+
+  /*
+   * Constructor
+   */
+  Compressor16(const uint16_t *log2_table, const uint16_t *exp2_table) :
+    log2_table(log2_table), exp2_table(exp2_table), threshold(0),
+    slope(0), makeup(0), attack(0x4000), release(0x0400), level(-0x8000),
+    gain(0xFFFF), shift(0), peak(0), count(0) {
+    ; // Do nothing
+  }
+
+  /*
+   * Peak level in log2 units, Q5.11 relative to 0x8000
+   */
+  int16_t log2_level(uint16_t a) {
+    if (!a)
+      return -0x8000;
+    uint8_t z = 0;
+    while (!(a & 0x8000)) {
+      a <<= 1;
+      z++;
+    }
+    uint16_t frac = pgm_read_word(log2_table + ((a >> 7) & 0xFF));
+    return -((int16_t)z << 11) + (frac >> 5);
+  }
+
+  /*
+   * Recompute the gain from the peak since the last update
+   */
+  void update() {
+    level = log2_level(peak);
+    peak = 0;
+    int32_t over = (int32_t)level - threshold;
+    typedef Fixed<5, 11, true> Q5_11;
+    int16_t target = over > 0 ? -(Q5_11(over > 0x7FFF ? 0x7FFF : over) * 
+      UQ16(slope)).raw : 0;
+    smoother.coeff = target < (smoother.lp >> 16) ? attack : release;
+    smoother.process(target);
+    int16_t g = addsat16((int16_t)((smoother.lp + 0x8000) >> 16), makeup);
+    if (!g) {
+      gain = 0xFFFF;
+      shift = 0;
+      return;
+    }
+    uint16_t mant = 0x8000 + 
+      (pgm_read_word(exp2_table + ((g >> 3) & 0xFF)) >> 1);
+    int8_t s = (g >> 11) + 1;               // 2^g = mant * 2^s, mant in UQ16
+    if (s > 0) {
+      gain = mant;
+      shift = s;
+    } else {
+      gain = s > -16 ? mant >> -s : 0;
+      shift = 0;
+    }
+  }
+
+  /*
+   * Process a sample [-0x8000, 0x7FFF]
+   */
+  int16_t process(int16_t sample) {
+    uint16_t a = sample < 0 ? -(uint16_t)sample : sample;
+    if (a > peak)
+      peak = a;
+    if (count) {
+      count--;
+    } else {
+      count = N - 1;
+      update();
+    }
+    int16_t y = qmul16(gain, sample);
+    if (shift) {
+      int32_t z = (int32_t)y << shift;
+      y = z > 0x7FFF ? 0x7FFF : z < -0x8000 ? -0x8000 : z;
+    }
+    return y;
+  }
+
+  /*
+   * Process a block of n samples in place
+   */
+  void process_block(int16_t *buf, uint8_t n) {
+    for (uint8_t i = 0; i < n; i++)
+      buf[i] = process(buf[i]);
+  }
+
+  /*
+   * Data
+   */
+  const uint16_t *log2_table;   // log2(1 + n/256) in program memory
+  const uint16_t *exp2_table;   // 2^(n/256) - 1 in program memory
+  int16_t threshold;            // Q5.11 log2 units, <= 0
+  uint16_t slope;               // 1 - 1/ratio, UQ16
+  int16_t makeup;               // Q5.11 log2 units
+  uint16_t attack;              // Coefficient while reduction increases
+  uint16_t release;             // Coefficient while reduction decreases
+  OnePole16_LF smoother;        // Gain reduction, Q5.11 log2 units
+  int16_t level;                // Latest detected level, Q5.11 log2 units
+  uint16_t gain;                // Applied gain, UQ16
+  uint8_t shift;                // Applied left shift, for net gain > 1
+  uint16_t peak;                // Peak magnitude since the last update
+  uint8_t count;                // Samples until next update
+};
+
+#endif
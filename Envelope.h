@@ -89,6 +89,54 @@ struct ASR16 {
     return value;
   }
 
+  /*
+   * Render a block of n samples. Runs of samples within a state are 
+   * rendered in tight loops, switching only at state boundaries.
+   */
+  void render_block(uint16_t *out, uint8_t n) {
+    uint16_t v = value;
+    uint16_t new_val;
+    uint8_t i = 0;
+    while (i < n) {
+      switch (state) {
+        // Attack until overflow
+        case EnvStateAttack:
+          for (; i < n; i++) {
+            new_val = v + atk_rate;
+            if (new_val < v) {
+              v = 0xFFFF;
+              state = EnvStateSustain;
+              out[i++] = v;
+              break;
+            }
+            v = new_val;
+            out[i] = v;
+          }
+          break;
+        // Release until underflow
+        case EnvStateRelease:
+          for (; i < n; i++) {
+            new_val = v - rel_rate;
+            if (new_val > v) {
+              v = 0;
+              state = EnvStateIdle;
+              out[i++] = v;
+              break;
+            }
+            v = new_val;
+            out[i] = v;
+          }
+          break;
+        // Idle, sustain, or unknown: hold
+        default:
+          for (; i < n; i++)
+            out[i] = v;
+          break;
+      }
+    }
+    value = v;
+  }
+
   /*
    * Data
    */
@@ -100,4 +148,265 @@ struct ASR16 {
   uint16_t rel_rate;  // Normalized release rate 
 };
 
+/*
+ * ADSR envelope generator with per-stage linear or exponential curves
+ * - Linear stages step by their rate per sample, as in ASR16
+ * - Exponential stages are a one-pole approach toward a target beyond the
+ *   stage's end, which is reached in finite time:
+ *    - Attack toward 0xFFFF + 0x4000 (concave, ~1.6/rate * 2^16 samples)
+ *    - Decay and release toward 0x200 below their end (the usual decaying
+ *      exponential, ~4.9/rate * 2^16 samples over full range)
+ *   costing one 16x16 multiply per sample more than a linear stage, with
+ *   no table lookups
+ * - Output is the high 16 bits of a 32-bit accumulator (value << 15), so 
+ *   slow exponential stages never stall on rounding
+ * - Retrigger mode restarts the attack from the current value on every 
+ *   gate on. Legato mode ignores gate on while the gate is already held.
+ */
+struct ADSR16 {
+
+  /*
+   * Enumeration of envelope states, stage curves, and gate modes
+   */
+  enum {
+    EnvStateIdle = 0,
+    EnvStateAttack,
+    EnvStateDecay,
+    EnvStateSustain,
+    EnvStateRelease
+  };
+  enum {
+    EnvCurveLinear = 0,
+    EnvCurveExp
+  };
+  enum {
+    EnvModeRetrigger = 0,
+    EnvModeLegato
+  };
+
+  /*
+   * Constructor
+   */
+  ADSR16() : state(EnvStateIdle), value(0), acc(0), atk_rate(0x7FFF), 
+    dec_rate(0x7FFF), rel_rate(0x7FFF), sustain(0xFFFF), 
+    atk_curve(EnvCurveLinear), dec_curve(EnvCurveLinear), 
+    rel_curve(EnvCurveLinear), mode(EnvModeRetrigger) {
+    ;   // Do nothing
+  }
+
+  /* 
+   * Begin (HIGH) or end (LOW) a note
+   */
+  void gate(bool on) {
+    if (on) {
+      if (mode == EnvModeLegato && state != EnvStateIdle && state != EnvStateRelease)
+        return;
+      state = EnvStateAttack;
+    }
+    else if (state != EnvStateIdle)
+      state = EnvStateRelease;
+  }
+
+  /*
+   * Render a sample after handling end of state conditions
+   */
+  uint16_t render() {
+    uint32_t step;
+    switch (state) {
+      // Attack to 0xFFFF, then decay
+      case EnvStateAttack:
+        if (atk_curve == EnvCurveExp)
+          step = (uint32_t)((uint16_t)((0xFFFFUL + 0x4000 - value) >> 1)) * atk_rate;
+        else
+          step = (uint32_t)atk_rate << 15;
+        if (step >= TOP - acc) {
+          acc = TOP;
+          state = EnvStateDecay;
+        }
+        else
+          acc += step;
+        break;
+      // Decay to sustain level, then hold
+      case EnvStateDecay:
+        if (dec_curve == EnvCurveExp)
+          step = (uint32_t)((uint16_t)((value - sustain + 0x200UL) >> 1)) * dec_rate;
+        else
+          step = (uint32_t)dec_rate << 15;
+        if (value <= sustain || step >= acc - ((uint32_t)sustain << 15)) {
+          acc = (uint32_t)sustain << 15;
+          state = EnvStateSustain;
+        }
+        else
+          acc -= step;
+        break;
+      // Sustain, following the level
+      case EnvStateSustain:
+        acc = (uint32_t)sustain << 15;
+        break;
+      // Release to zero, then idle
+      case EnvStateRelease:
+        if (rel_curve == EnvCurveExp)
+          step = (uint32_t)((uint16_t)((value + 0x200UL) >> 1)) * rel_rate;
+        else
+          step = (uint32_t)rel_rate << 15;
+        if (step >= acc) {
+          acc = 0;
+          state = EnvStateIdle;
+        }
+        else
+          acc -= step;
+        break;
+      // Idle or unknown
+      default:
+        break;
+    }
+    value = acc >> 15;
+    return value;
+  }
+
+  /*
+   * Render a block of n samples
+   */
+  void render_block(uint16_t *out, uint8_t n) {
+    for (uint8_t i = 0; i < n; i++)
+      out[i] = render();
+  }
+
+  /*
+   * Data
+   */
+  static const uint32_t TOP = 0xFFFFUL << 15;   // Accumulator at 0xFFFF
+  uint8_t state;      // Current state
+  uint16_t value;     // Current output value
+  uint32_t acc;       // Accumulator, value << 15
+      
+  // Parameters (directly settable)
+  uint16_t atk_rate;  // Normalized attack rate (linear) or coefficient (exp)
+  uint16_t dec_rate;  // Normalized decay rate or coefficient
+  uint16_t rel_rate;  // Normalized release rate or coefficient
+  uint16_t sustain;   // Sustain level
+  uint8_t atk_curve;  // EnvCurveLinear or EnvCurveExp, per stage
+  uint8_t dec_curve;
+  uint8_t rel_curve;
+  uint8_t mode;       // EnvModeRetrigger or EnvModeLegato
+};
+
+/*
+ * Multi-segment (breakpoint) envelope from a PROGMEM table
+ * - Table of n (level, rate) pairs, one per segment, e.g.
+ *     const uint16_t shape[] PROGMEM = {
+ *       0xFFFF, 0x0100,   // 0: Rise to full scale
+ *       0x4000, 0x0020,   // 1: Fall to 1/4
+ *       0x8000, 0x0020,   // 2: Rise to 1/2
+ *       0x0000, 0x0008    // 3: Release to zero
+ *     };
+ *     Breakpoint16 env(shape, 4, 1, 2);  // Loop segments 1-2 while gate held
+ * - Each segment ramps linearly from the current value to its level, 
+ *   stepping by its rate per sample as ASR16 does (rate 0 jumps directly)
+ * - While the gate is held, the end of segment loop_end continues at 
+ *   loop_start. After gate off the loop is left at its next pass. After the
+ *   last segment, the last level is held.
+ * - The table is read only on entering a segment; other samples cost an
+ *   add and two compares
+ */
+struct Breakpoint16 {
+
+  /*
+   * No loop
+   */
+  enum {
+    NoLoop = 0xFF
+  };
+
+  /*
+   * Constructor for user-provided table of n_segments (level, rate) pairs,
+   * with optional loop points
+   */
+  Breakpoint16(const uint16_t *segments, uint8_t n_segments, uint8_t loop_start = NoLoop, 
+    uint8_t loop_end = NoLoop) : segments(segments), n_segments(n_segments), 
+    loop_start(loop_start), loop_end(loop_end), seg(n_segments), held(false), 
+    value(0), target(0), rate(0) {
+    ;   // Do nothing
+  }
+
+  /* 
+   * Begin (HIGH) a note from the first segment, or end (LOW) it
+   */
+  void gate(bool on) {
+    held = on;
+    if (on)
+      enter(0);
+  }
+
+  /*
+   * Render a sample, entering the next segment on reaching a level
+   */
+  uint16_t render() {
+    uint16_t new_val;
+    if (seg >= n_segments)        // Done, hold
+      return value;
+    if (value < target) {
+      new_val = value + rate;
+      if (new_val < value || new_val >= target || !rate) {
+        value = target;
+        next();
+      }
+      else
+        value = new_val;
+    }
+    else {
+      new_val = value - rate;
+      if (new_val > value || new_val <= target || !rate) {
+        value = target;
+        next();
+      }
+      else
+        value = new_val;
+    }
+    return value;
+  }
+
+  /*
+   * Render a block of n samples
+   */
+  void render_block(uint16_t *out, uint8_t n) {
+    for (uint8_t i = 0; i < n; i++)
+      out[i] = render();
+  }
+
+  /*
+   * Load segment k's level and rate (or finish, past the last segment)
+   */
+  void enter(uint8_t k) {
+    seg = k;
+    if (k < n_segments) {
+      target = pgm_read_word(segments + 2 * k);
+      rate = pgm_read_word(segments + 2 * k + 1);
+    }
+  }
+
+  /*
+   * Enter the segment after the current one, looping while the gate is held
+   */
+  void next() {
+    if (held && seg == loop_end)
+      enter(loop_start);
+    else
+      enter(seg + 1);
+  }
+
+  /*
+   * Data
+   */
+  const uint16_t *segments; // (level, rate) pairs in PROGMEM
+  uint8_t n_segments;
+  uint8_t loop_start;       // First segment of loop, or NoLoop
+  uint8_t loop_end;         // Last segment of loop, or NoLoop
+  uint8_t seg;              // Current segment (n_segments when done)
+  bool held;                // Gate state
+  uint16_t value;           // Current output value
+  uint16_t target;          // Current segment's level
+  uint16_t rate;            // Current segment's rate
+};
+
 #endif
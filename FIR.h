@@ -0,0 +1,169 @@
+/*
+  FIR.h
+
+  Finite impulse response filters, Q16 (signed) fixed point, with Q15
+  coefficients in program memory generated by tablegen.py.
+
+  Copyright (C) 2021 Jeff Gregorio
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef FIR_H
+#define FIR_H
+
+/*
+ * Smallest power of two >= n, for circular buffer sizes
+ */
+static constexpr uint8_t fir_buf_size(uint8_t n, uint8_t size = 1) {
+  return size >= n ? size : fir_buf_size(n, size << 1);
+}
+
+/*
+ * Saturate a 32-bit accumulator to a Q16 sample
+ */
+static inline int16_t fir_sat16(int32_t acc) {
+  return acc > 0x7FFF ? 0x7FFF : acc < -0x8000 ? -0x8000 : acc;
+}
+
+/*
+ * Signed 16-bit symmetric (linear phase) FIR filter with N taps
+ * - coeffs holds the first ceil(N/2) taps in Q15, outermost first, e.g.
+ *   from tablegen.py fir
+ * - Input samples pairing with the same tap are added before multiplying
+ *   (folding), so each output costs ceil(N/2) multiplies rather than N
+ * - History is kept in a power-of-two circular buffer, indexed by mask
+ * - Delay is (N-1)/2 samples
+ */
+template <uint8_t N>
+struct FIR16 {
+
+  static_assert(N >= 2 && N <= 128, "FIR16 needs 2 to 128 taps");
+
+  static constexpr uint8_t MASK = fir_buf_size(N) - 1;
+
+  /*
+   * Constructor
+   */
+  FIR16(const int16_t *coeffs) : coeffs(coeffs), hist(), pos(0) {
+    ; // Do nothing
+  }
+
+  /*
+   * Process a sample [-0x8000, 0x7FFF]
+   */
+  int16_t process(int16_t sample) {
+    pos = (pos + 1) & MASK;
+    hist[pos] = sample;
+    int32_t acc = 0x4000;                 // Rounding
+    uint8_t old = pos - (N - 1);          // Oldest sample
+    for (uint8_t k = 0; k < N / 2; k++) {
+      int16_t h = pgm_read_word(coeffs + k);
+      acc += (int32_t)h * 
+        ((int32_t)hist[old++ & MASK] + hist[(pos - k) & MASK]);
+    }
+    if (N & 1)
+      acc += (int32_t)(int16_t)pgm_read_word(coeffs + N / 2) *
+        hist[(pos - N / 2) & MASK];
+    return fir_sat16(acc >> 15);
+  }
+
+  /*
+   * Process a block of n samples in place
+   */
+  void process_block(int16_t *buf, uint8_t n) {
+    for (uint8_t i = 0; i < n; i++)
+      buf[i] = process(buf[i]);
+  }
+
+  /*
+   * Data
+   */
+  const int16_t *coeffs;              // Taps in program memory
+  int16_t hist[fir_buf_size(N)];      // Input history
+  uint8_t pos;                        // Index of the latest input
+};
+
+/*
+ * Signed 16-bit half-band FIR decimator by 2 with N = 4m-1 taps
+ * - A half-band low pass has a 0.5 center tap and every other tap zero, so
+ *   only the m nonzero taps on one side are stored (in Q15, nearest the
+ *   center first, e.g. from tablegen.py halfband) and multiplied, with
+ *   folding as in FIR16
+ * - Only every second input produces an output, so each output costs m
+ *   multiplies (6 for N = 23) and the other input just a buffer write
+ * - Cascade two to decimate by 4
+ * - Delay is (N-1)/2 input samples
+ */
+template <uint8_t N>
+struct HalfBandDecim16 {
+
+  static_assert(N >= 3 && N <= 127 && (N + 1) % 4 == 0,
+    "HalfBandDecim16 needs 4m-1 taps, at most 127");
+
+  static constexpr uint8_t MASK = fir_buf_size(N) - 1;
+
+  /*
+   * Constructor
+   */
+  HalfBandDecim16(const int16_t *coeffs) : coeffs(coeffs), hist(), pos(0),
+    phase(0), out(0) {
+    ; // Do nothing
+  }
+
+  /*
+   * Push an input sample [-0x8000, 0x7FFF]. Returns true on every second
+   * input, when a new output is available in out.
+   */
+  bool process(int16_t sample) {
+    pos = (pos + 1) & MASK;
+    hist[pos] = sample;
+    phase ^= 1;
+    if (phase)
+      return false;
+    uint8_t mid = pos - (N - 1) / 2;
+    int32_t acc = ((int32_t)hist[mid & MASK] << 14) + 0x4000;
+    for (uint8_t j = 0; j < (N + 1) / 4; j++) {
+      int16_t h = pgm_read_word(coeffs + j);
+      uint8_t d = 2 * j + 1;
+      acc += (int32_t)h * 
+        ((int32_t)hist[(mid + d) & MASK] + hist[(mid - d) & MASK]);
+    }
+    out = fir_sat16(acc >> 15);
+    return true;
+  }
+
+  /*
+   * Decimate a block of n samples in place. Returns the number of outputs,
+   * written to the start of buf.
+   */
+  uint8_t process_block(int16_t *buf, uint8_t n) {
+    uint8_t n_out = 0;
+    for (uint8_t i = 0; i < n; i++)
+      if (process(buf[i]))
+        buf[n_out++] = out;
+    return n_out;
+  }
+
+  /*
+   * Data
+   */
+  const int16_t *coeffs;              // Nonzero side taps in program memory
+  int16_t hist[fir_buf_size(N)];      // Input history
+  uint8_t pos;                        // Index of the latest input
+  uint8_t phase;                      // Inputs since the last output, 0 or 1
+  int16_t out;                        // Latest output
+};
+
+#endif
@@ -2,7 +2,8 @@
  * FixedPoint.h
  *
  * Fixed point math utility functions. Includes unsigned and signed
- * 8, 16, and 32-bit saturating addition, subtraction, and Q multiplicaiton.
+ * 8, 16, and 32-bit saturating addition, subtraction, and Q multiplicaiton,
+ * and a Fixed<> type that carries its UQM.N/QM.N format at compile time.
  * 
  * Copyright (C) 2021 Jeff Gregorio
  * 
@@ -37,17 +38,17 @@
  * Saturating addition (unsigned)
  */
 // 0.8us
-uint8_t addsat8(uint8_t a, uint8_t b) {
+inline uint8_t addsat8(uint8_t a, uint8_t b) {
   uint8_t c = a + b;
   return c < a ? MAX_U8 : c;
 }
 // 1.3us
-uint16_t addsat16(uint16_t a, uint16_t b) {
+inline uint16_t addsat16(uint16_t a, uint16_t b) {
   uint16_t c = a + b;
   return c < a ? MAX_U16 : c;
 }
 // 2.4us
-uint32_t addsat32(uint32_t a, uint32_t b) {
+inline uint32_t addsat32(uint32_t a, uint32_t b) {
   uint32_t c = a + b;
   return c < a ? MAX_U32 : c;
 }
@@ -56,17 +57,17 @@ uint32_t addsat32(uint32_t a, uint32_t b) {
  * Saturating subtraction (unsigned)
  */
 // 0.9us
-uint8_t subsat8(uint8_t a, uint8_t b) {
+inline uint8_t subsat8(uint8_t a, uint8_t b) {
   uint8_t c = a - b;
   return c > a ? 0 : c;
 }
 // 1.4us
-uint16_t subsat16(uint16_t a, uint16_t b) {
+inline uint16_t subsat16(uint16_t a, uint16_t b) {
   uint16_t c = a - b;
   return c > a ? 0 : c;
 }
 // 2.5us
-uint32_t subsat32(uint32_t a, uint32_t b) {
+inline uint32_t subsat32(uint32_t a, uint32_t b) {
   uint32_t c = a - b;
   return c > a ? 0 : c;
 }
@@ -75,17 +76,17 @@ uint32_t subsat32(uint32_t a, uint32_t b) {
  * Saturating addition (unsigned, signed)
  */
 // 0.8us
-int8_t addsat8(uint8_t a, int8_t b) {
+inline int8_t addsat8(uint8_t a, int8_t b) {
   int8_t c = a + b;
   return c < b ? MAX_S8 : c;
 }
 // 1.3us
-int16_t addsat16(uint16_t a, int16_t b) {
+inline int16_t addsat16(uint16_t a, int16_t b) {
   int16_t c = a + b;
   return c < b ? MAX_S16 : c;
 }
 // 2.4us
-int32_t addsat32(uint32_t a, int32_t b) {
+inline int32_t addsat32(uint32_t a, int32_t b) {
   int32_t c = a + b;
   return c < b ? MAX_S32 : c;
 }
@@ -97,7 +98,7 @@ int32_t addsat32(uint32_t a, int32_t b) {
  * - Ternary saturates with direction based on operand sign
  */
 // 0.9 - 1.1us
-int8_t addsat8(int8_t a, int8_t b) {
+inline int8_t addsat8(int8_t a, int8_t b) {
   int8_t c = a + b;
   if (((a ^ b) & MIN_S8) == 0) {    
     if ((c ^ a) & MIN_S8)            
@@ -106,7 +107,7 @@ int8_t addsat8(int8_t a, int8_t b) {
   return c;
 }
 // 1.4 - 2us
-int16_t addsat16(int16_t a, int16_t b) {
+inline int16_t addsat16(int16_t a, int16_t b) {
   int16_t c = a + b;
   if (((a ^ b) & MIN_S16) == 0) {
     if ((c ^ a) & MIN_S16)
@@ -116,7 +117,7 @@ int16_t addsat16(int16_t a, int16_t b) {
 }
 
 // 2.4 - 3.5us
-int32_t addsat32(int32_t a, int32_t b) {
+inline int32_t addsat32(int32_t a, int32_t b) {
   int32_t c = a + b;
   if (((a ^ b) & MIN_S32) == 0) {
     if ((c ^ a) & MIN_S32)
@@ -126,64 +127,429 @@ int32_t addsat32(int32_t a, int32_t b) {
 }
 
 /*
- * Q multiplication (unsigned)
+ * Q multiplication
  * - Note: all multiplications are rounded (i.e. round(x) = floor(x + 0.5))
  *  - by adding 1 << (K-1) before right-shifting by K 
+ * - 16 and 32-bit versions dispatch at compile time to partial product
+ *   kernels on AVR (see below), or the portable _ref versions elsewhere
+ */
+
+/*
+ * Q multiplication reference (unsigned)
  */
 // 0.8us
-uint8_t qmul8(uint8_t a, uint8_t b) {
+inline uint8_t qmul8(uint8_t a, uint8_t b) {
   return (uint16_t)a * b + 0x80 >> 8;
 }
 // 2.9us
-uint16_t qmul16(uint16_t a, uint16_t b) {
+inline uint16_t qmul16_ref(uint16_t a, uint16_t b) {
   return (uint32_t)a * b + 0x8000 >> 16;
 }
 // 18.1us
-uint32_t qmul32(uint32_t a, uint32_t b) {
+inline uint32_t qmul32_ref(uint32_t a, uint32_t b) {
   return (uint64_t)a * b + 0x80000000 >> 32;
 }
 
 /*
- *  Q multiplication (unsigned, signed)
+ *  Q multiplication reference (unsigned, signed)
  */
 // 0.9us
-int8_t qmul8(uint8_t a, int8_t b) {
+inline int8_t qmul8(uint8_t a, int8_t b) {
   return (int16_t)b * a + 0x80 >> 8;
 }
 // 3.8us
-int16_t qmul16(uint16_t a, int16_t b) {
+inline int16_t qmul16_ref(uint16_t a, int16_t b) {
   return (int32_t)b * a + 0x8000 >> 16;
 }
 // 27us
-int32_t qmul32(uint32_t a, int32_t b) {
+inline int32_t qmul32_ref(uint32_t a, int32_t b) {
   return (int64_t)b * a + 0x80000000 >> 32;
 }
 
 /*
- *  Q multiplication (signed)
+ *  Q multiplication reference (signed)
  */
 // 1.4uS
-int8_t qmul8(int8_t a, int8_t b) {
+inline int8_t qmul8(int8_t a, int8_t b) {
   int16_t temp;
   temp = (int16_t)a * b + 0x40;
   temp = temp < 0x4000 ? temp : 0x3FFF;
   return temp >> 7;
 }
 // 11us
-int16_t qmul16(int16_t a, int16_t b) {
+inline int16_t qmul16_ref(int16_t a, int16_t b) {
   int32_t temp;
   temp = (int32_t)a * b + 0x4000;
   temp = temp < 0x40000000 ? temp : 0x3FFFFFFF;
   return temp >> 15;
 }
 // 26us
-int32_t qmul32(int32_t a, int32_t b) {
+inline int32_t qmul32_ref(int32_t a, int32_t b) {
   int64_t temp;
   temp = (int64_t)a * b + 0x40000000;
   temp = temp < 0x4000000000000000 ? temp : 0x3FFFFFFFFFFFFFFF;
   return temp >> 31;
 }
 
+/*
+ * Q multiplication partial product kernels
+ * - Operands are split into bytes (16-bit) or words (32-bit) and only the
+ *   partial products the rounded high half depends on are summed. The low 
+ *   byte/word of the lowest product can't carry, so it's shifted out before
+ *   accumulating, and the accumulators stay narrower than the full product.
+ * - Each 8x8 product compiles to one AVR MUL (unsigned x unsigned), MULS 
+ *   (signed x signed), or MULSU (signed x unsigned). Each 16x16 product 
+ *   compiles to avr-gcc's 4-MUL widening multiply helpers, rather than the
+ *   generic 32 or 64-bit multiply the _ref versions need.
+ * - The 32-bit kernels accumulate in 32-bit words: signed cross products
+ *   are split into a high word added to the result and an unsigned low 
+ *   word, and carries out of the low sum are tracked with a compare, so no
+ *   64-bit adds or shifts are generated. Est. ~60-70 cycles each on AVR,
+ *   not measured.
+ * - Portable, so host builds can check them against the _ref versions.
+ */
+// 4 MUL
+inline uint16_t qmul16_pp(uint16_t a, uint16_t b) {
+  uint8_t al = a, ah = a >> 8;
+  uint8_t bl = b, bh = b >> 8;
+  uint32_t mid;   // Product >> 8, plus rounding
+  mid = (uint32_t)(uint16_t)al * bh + (uint16_t)ah * bl + 
+    ((uint16_t)al * bl >> 8) + 0x80;
+  return (uint16_t)ah * bh + (uint16_t)(mid >> 8);
+}
+// 2 MUL, 2 MULSU
+inline int16_t qmul16_pp(uint16_t a, int16_t b) {
+  uint8_t al = a, ah = a >> 8;
+  uint8_t bl = b; 
+  int8_t bh = b >> 8;
+  int32_t mid;    // Product >> 8, plus rounding
+  mid = ((int32_t)(int16_t)(bh * ah) << 8) + (int16_t)(bh * al) + 
+    (uint16_t)ah * bl + ((uint16_t)al * bl >> 8) + 0x80;
+  return (int16_t)((uint32_t)mid >> 8);
+}
+// 1 MUL, 2 MULSU, 1 MULS
+inline int16_t qmul16_pp(int16_t a, int16_t b) {
+  uint8_t al = a, bl = b;
+  int8_t ah = a >> 8, bh = b >> 8;
+  int32_t mid;    // Product >> 8, plus rounding
+  mid = ((int32_t)(int16_t)(ah * bh) << 8) + (int16_t)(ah * bl) + 
+    (int16_t)(bh * al) + ((uint16_t)al * bl >> 8) + 0x40;
+  if (mid >= 0x400000)  // Only -1 x -1 overflows
+    return MAX_S16;
+  return (int16_t)((uint32_t)mid << 1 >> 8);
+}
+// 4 16x16 products (16 MUL)
+inline uint32_t qmul32_pp(uint32_t a, uint32_t b) {
+  uint16_t al = a, ah = a >> 16;
+  uint16_t bl = b, bh = b >> 16;
+  uint32_t lh = (uint32_t)al * bh;
+  uint32_t mid = lh + (uint32_t)ah * bl;  // Sum of cross products, may carry
+  uint32_t hi = (uint32_t)ah * bh + (mid < lh ? 0x10000 : 0);
+  uint32_t rnd = mid + (((uint32_t)al * bl >> 16) + 0x8000);
+  return hi + (rnd >> 16) + (rnd < mid ? 0x10000 : 0);
+}
+// 4 16x16 products (12 MUL, 4 MULSU)
+inline int32_t qmul32_pp(uint32_t a, int32_t b) {
+  uint16_t al = a, ah = a >> 16;
+  uint16_t bl = b;
+  int16_t bh = b >> 16;
+  int32_t hl = (int32_t)bh * al;  // Signed cross product, high word to hi
+  int32_t hi = (int32_t)bh * ah + (hl >> 16);
+  uint32_t mid = (uint32_t)ah * bl;
+  uint32_t rnd = mid + ((uint16_t)hl + ((uint32_t)al * bl >> 16) + 0x8000);
+  return (int32_t)((uint32_t)hi + (rnd >> 16) + (rnd < mid ? 0x10000 : 0));
+}
+// 4 16x16 products (9 MUL, 6 MULSU, 1 MULS)
+inline int32_t qmul32_pp(int32_t a, int32_t b) {
+  uint16_t al = a, bl = b;
+  int16_t ah = a >> 16, bh = b >> 16;
+  int32_t hl = (int32_t)ah * bl, lh = (int32_t)bh * al; // High words to hi
+  int32_t hi = (int32_t)ah * bh + (hl >> 16) + (lh >> 16);
+  uint32_t mid;   // Low words of the cross products, < 2^18 so no carry out
+  mid = (uint32_t)(uint16_t)hl + (uint16_t)lh + 
+    ((uint32_t)al * bl >> 16) + 0x4000;
+  if (hi >= 0x40000000)   // Only -1 x -1 overflows
+    return MAX_S32;
+  return (int32_t)(((uint32_t)hi << 1) + (mid >> 15));
+}
+
+/*
+ * Q multiplication (unsigned; unsigned, signed; signed)
+ */
+#ifdef __AVR__
+inline uint16_t qmul16(uint16_t a, uint16_t b) { return qmul16_pp(a, b); }
+inline uint32_t qmul32(uint32_t a, uint32_t b) { return qmul32_pp(a, b); }
+inline int16_t qmul16(uint16_t a, int16_t b) { return qmul16_pp(a, b); }
+inline int32_t qmul32(uint32_t a, int32_t b) { return qmul32_pp(a, b); }
+inline int16_t qmul16(int16_t a, int16_t b) { return qmul16_pp(a, b); }
+inline int32_t qmul32(int32_t a, int32_t b) { return qmul32_pp(a, b); }
+#else
+inline uint16_t qmul16(uint16_t a, uint16_t b) { return qmul16_ref(a, b); }
+inline uint32_t qmul32(uint32_t a, uint32_t b) { return qmul32_ref(a, b); }
+inline int16_t qmul16(uint16_t a, int16_t b) { return qmul16_ref(a, b); }
+inline int32_t qmul32(uint32_t a, int32_t b) { return qmul32_ref(a, b); }
+inline int16_t qmul16(int16_t a, int16_t b) { return qmul16_ref(a, b); }
+inline int32_t qmul32(int32_t a, int32_t b) { return qmul32_ref(a, b); }
+#endif
+
+/*
+ * Integer square root, floor(sqrt(x))
+ * - Digit-by-digit (base 4): 16 iterations of shifts, compares, and 
+ *   subtracts, with no multiplies or divisions
+ * - For a UQ32 argument the result is UQ16; for a UQ30 argument, UQ15
+ */
+inline uint16_t usqrt32(uint32_t x) {
+  uint32_t root = 0, bit = (uint32_t)1 << 30;
+  while (bit > x)
+    bit >>= 2;
+  while (bit) {
+    if (x >= root + bit) {
+      x -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return root;
+}
+
+/*
+ * Fixed point type with compile-time Q format
+ * - Fixed<IntBits, FracBits, Signed> stores a value in UQM.N or QM.N format,
+ *   where M = IntBits (including the sign bit, if any) and N = FracBits
+ * - IntBits + FracBits must be 8, 16, or 32, the width of the storage type 
+ * - All operations are constexpr and inline, so format conversions resolve
+ *   to a single shift (or none) at compile time
+ *
+ *   UQ16 gain(0xC000);                         // 0.75
+ *   Q16 x(0x4000);                             // 0.5
+ *   Q16 y = x * gain;                          // 0.375, rounded, Q16 result
+ *   Fixed<16, 16, false> f = x.as<Fixed<16, 16, false> >(); 
+ */
+
+/*
+ * Storage type selection by bit width and signedness
+ */
+template <uint8_t Bits, bool Signed> struct FixedInt;
+template <> struct FixedInt<8, false> { typedef uint8_t type; };
+template <> struct FixedInt<8, true> { typedef int8_t type; };
+template <> struct FixedInt<16, false> { typedef uint16_t type; };
+template <> struct FixedInt<16, true> { typedef int16_t type; };
+template <> struct FixedInt<32, false> { typedef uint32_t type; };
+template <> struct FixedInt<32, true> { typedef int32_t type; };
+template <> struct FixedInt<64, false> { typedef uint64_t type; };
+template <> struct FixedInt<64, true> { typedef int64_t type; };
+
+/*
+ * Narrowest storage type holding at least Bits bits
+ */
+template <uint8_t Bits, bool Signed> struct FixedIntFit {
+  typedef typename FixedInt<(Bits <= 8) ? 8 : (Bits <= 16) ? 16 : 
+    (Bits <= 32) ? 32 : 64, Signed>::type type;
+};
+
+/*
+ * Shift by a compile-time count: left if Shift > 0, right if Shift < 0.
+ * Left shifts multiply so negative signed values are well defined.
+ */
+template <int Shift, bool Left = (Shift > 0)> struct FixedShift {
+  template <typename T> static constexpr T apply(T x) {
+    return x * ((T)1 << Shift);
+  }
+};
+template <int Shift> struct FixedShift<Shift, false> {
+  template <typename T> static constexpr T apply(T x) {
+    return x >> -Shift;
+  }
+};
+
+/*
+ * Rounded right shift by a compile-time count, i.e. round(x / 2^Shift)
+ */
+template <uint8_t Shift> struct FixedRound {
+  template <typename T> static constexpr T apply(T x) {
+    return (x + ((T)1 << (Shift - 1))) >> Shift;
+  }
+};
+template <> struct FixedRound<0> {
+  template <typename T> static constexpr T apply(T x) {
+    return x;
+  }
+};
+
+/*
+ * Saturating addition and subtraction of raw values
+ * - Unsigned: overflow wraps the result below (add) or above (subtract) a
+ * - Signed: overflow only when operands' signs match (add) or differ 
+ *   (subtract) and the result's sign differs from a's
+ */
+template <bool Signed> struct FixedSat {
+  template <typename T, typename U> 
+  static constexpr T add(T a, T b, T, T hi) {
+    return (T)((U)a + (U)b) < a ? hi : (T)((U)a + (U)b);
+  }
+  template <typename T, typename U> 
+  static constexpr T sub(T a, T b, T lo, T) {
+    return (T)((U)a - (U)b) > a ? lo : (T)((U)a - (U)b);
+  }
+};
+template <> struct FixedSat<true> {
+  template <typename T, typename U> 
+  static constexpr T add(T a, T b, T lo, T hi) {
+    return (a ^ b) >= 0 && ((T)((U)a + (U)b) ^ a) < 0 ? 
+      (a < 0 ? lo : hi) : (T)((U)a + (U)b);
+  }
+  template <typename T, typename U> 
+  static constexpr T sub(T a, T b, T lo, T hi) {
+    return (a ^ b) < 0 && ((T)((U)a - (U)b) ^ a) < 0 ? 
+      (a < 0 ? lo : hi) : (T)((U)a - (U)b);
+  }
+};
+
+template <uint8_t IntBits, uint8_t FracBits, bool Signed = true>
+struct Fixed {
+
+  static_assert(IntBits + FracBits == 8 || IntBits + FracBits == 16 ||
+    IntBits + FracBits == 32, "Fixed: IntBits + FracBits must be 8, 16, or 32");
+
+  enum { 
+    Int = IntBits, 
+    Frac = FracBits, 
+    Bits = IntBits + FracBits, 
+    IsSigned = Signed 
+  };
+  typedef typename FixedInt<Bits, Signed>::type raw_t;
+  typedef typename FixedInt<Bits, false>::type uraw_t;
+
+  /*
+   * Constructors: zero, or from a raw integer in this format
+   */
+  constexpr Fixed() : raw(0) {
+    ; // Do nothing
+  }
+  explicit constexpr Fixed(raw_t raw) : raw(raw) {
+    ; // Do nothing
+  }
+
+  /*
+   * Conversion from a floating point constant (rounded). Intended for 
+   * compile-time constants; avoid calling on AVR at run time.
+   */
+  static constexpr Fixed from_float(double x) {
+    return Fixed((raw_t)(x * ((uint64_t)1 << FracBits) + (x < 0 ? -0.5 : 0.5)));
+  }
+  constexpr double to_float() const {
+    return (double)raw / ((uint64_t)1 << FracBits);
+  }
+
+  /*
+   * Representable range
+   */
+  static constexpr raw_t max_raw() {
+    return Signed ? (raw_t)((uraw_t)~(uraw_t)0 >> 1) : (raw_t)~(uraw_t)0;
+  }
+  static constexpr raw_t min_raw() {
+    return Signed ? (raw_t)~max_raw() : 0;
+  }
+
+  /*
+   * Conversion to another format (truncating)
+   * - Fractional bits are added with a left shift in the destination type,
+   *   or dropped with a right shift in this type
+   */
+  template <typename To> constexpr To as() const {
+    return To((typename To::raw_t)(
+      (int)To::Frac > (int)Frac ?
+        FixedShift<(int)To::Frac - (int)Frac>::apply((typename To::raw_t)raw) :
+        (typename To::raw_t)FixedShift<(int)To::Frac - (int)Frac>::apply(raw)));
+  }
+
+  /*
+   * Wrapping arithmetic within this format
+   */
+  constexpr Fixed operator+(Fixed b) const { return Fixed((raw_t)((uraw_t)raw + (uraw_t)b.raw)); }
+  constexpr Fixed operator-(Fixed b) const { return Fixed((raw_t)((uraw_t)raw - (uraw_t)b.raw)); }
+  constexpr Fixed operator-() const { return Fixed((raw_t)-(uraw_t)raw); }
+  constexpr Fixed operator>>(uint8_t n) const { return Fixed((raw_t)(raw >> n)); }
+
+  /*
+   * Rounded Q multiplication by any format, result in this format
+   * - The product is formed in the narrowest type holding both operands
+   *   (e.g. UQ8 x Q16 needs only 32 bits), then shifted right by b's 
+   *   fractional bits with rounding. Integer operands (FracBits == 0) need
+   *   no shift or rounding at all.
+   */
+  template <uint8_t I2, uint8_t F2, bool S2>
+  constexpr Fixed operator*(Fixed<I2, F2, S2> b) const {
+    return Fixed((raw_t)Fixed::template product<I2, F2, S2>(raw, b.raw));
+  }
+
+  /*
+   * Saturating Q multiplication by any format
+   */
+  template <uint8_t I2, uint8_t F2, bool S2>
+  constexpr Fixed mulsat(Fixed<I2, F2, S2> b) const {
+    return Fixed(clamp<typename FixedIntFit<Bits + I2 + F2, Signed || S2>::type>(
+      Fixed::template product<I2, F2, S2>(raw, b.raw)));
+  }
+
+  /*
+   * Saturating addition and subtraction
+   */
+  constexpr Fixed addsat(Fixed b) const {
+    return Fixed(FixedSat<Signed>::template add<raw_t, uraw_t>(raw, b.raw, min_raw(), max_raw()));
+  }
+  constexpr Fixed subsat(Fixed b) const {
+    return Fixed(FixedSat<Signed>::template sub<raw_t, uraw_t>(raw, b.raw, min_raw(), max_raw()));
+  }
+
+  /*
+   * Comparison
+   */
+  constexpr bool operator==(Fixed b) const { return raw == b.raw; }
+  constexpr bool operator!=(Fixed b) const { return raw != b.raw; }
+  constexpr bool operator<(Fixed b) const { return raw < b.raw; }
+  constexpr bool operator>(Fixed b) const { return raw > b.raw; }
+  constexpr bool operator<=(Fixed b) const { return raw <= b.raw; }
+  constexpr bool operator>=(Fixed b) const { return raw >= b.raw; }
+
+  /*
+   * Product of raw values shifted to this format with rounding
+   */
+  template <uint8_t I2, uint8_t F2, bool S2>
+  static constexpr typename FixedIntFit<Bits + I2 + F2, Signed || S2>::type 
+  product(raw_t a, typename Fixed<I2, F2, S2>::raw_t b) {
+    return FixedRound<F2>::apply(
+      (typename FixedIntFit<Bits + I2 + F2, Signed || S2>::type)a * b);
+  }
+
+  /*
+   * Clamp a wider value to this format's range
+   * - The lower bound applies to unsigned formats too, so a negative signed
+   *   product saturates to 0 rather than wrapping
+   */
+  template <typename T> static constexpr raw_t clamp(T x) {
+    return x > (T)max_raw() ? max_raw() : 
+      x < (T)min_raw() ? min_raw() : (raw_t)x;
+  }
+
+  /*
+   * Data
+   */
+  raw_t raw;
+};
+
+/*
+ * Formats used throughout LibAG (see README section 4)
+ */
+typedef Fixed<0, 8, false> UQ8;
+typedef Fixed<0, 16, false> UQ16;
+typedef Fixed<0, 32, false> UQ32;
+typedef Fixed<1, 7, true> Q8;
+typedef Fixed<1, 15, true> Q16;
+typedef Fixed<1, 31, true> Q32;
+
 #endif
 
 
@@ -48,6 +48,21 @@ struct OnePole16 {
     return lp;
   }
 
+  /*
+   * Process a block of n samples in place
+   */
+  void process_block(int16_t *buf, uint8_t n) {
+    int16_t h = hp, l = lp;
+    uint16_t c = coeff;
+    for (uint8_t i = 0; i < n; i++) {
+      h = (buf[i] >> 1) - (l >> 1);
+      l += (int32_t)c * h >> 15;
+      buf[i] = l;
+    }
+    hp = h;
+    lp = l;
+  }
+
   /*
    * Data
    */
@@ -80,6 +95,21 @@ struct OnePole16_LF {
     return lp >> 16;  // Return lp as Q16, keep it stored as Q32
   }
 
+  /*
+   * Process a block of n samples in place
+   */
+  void process_block(int16_t *buf, uint8_t n) {
+    int32_t h = hp << 16, l = lp;   // hp is stored as Q16
+    uint16_t c = coeff;
+    for (uint8_t i = 0; i < n; i++) {
+      h = ((int32_t)buf[i] << 16) - l;
+      l += (int64_t)c * h >> 16;
+      buf[i] = l >> 16;
+    }
+    hp = h >> 16;
+    lp = l;
+  }
+
   /*
    * Data
    */
@@ -112,6 +142,24 @@ struct TPTOnePole16 {
     return lp;
   }
 
+  /*
+   * Process a block of n samples in place
+   */
+  void process_block(int16_t *buf, uint8_t n) {
+    int16_t h = hp, l = lp, s = state, hs;
+    uint16_t c = coeff;
+    for (uint8_t i = 0; i < n; i++) {
+      h = buf[i] - s;
+      hs = (int32_t)c * h >> 16;
+      l = hs + s;
+      s = l + hs;
+      buf[i] = l;
+    }
+    hp = h;
+    lp = l;
+    state = s;
+  }
+
   int16_t lp, hp;
   int16_t state;
   uint16_t coeff;
@@ -142,9 +190,503 @@ struct TPTOnePole16_LF {
     return lp >> 16;
   }
 
+  /*
+   * Process a block of n samples in place
+   */
+  void process_block(int16_t *buf, uint8_t n) {
+    int32_t h = hp << 16, l = lp, s = state, hs;  // hp is stored as Q16
+    uint16_t c = coeff;
+    for (uint8_t i = 0; i < n; i++) {
+      h = ((int32_t)buf[i] << 16) - s;
+      hs = (int64_t)c * h >> 16;
+      l = hs + s;
+      s = l + hs;
+      buf[i] = l >> 16;
+    }
+    hp = h >> 16;
+    lp = l;
+    state = s;
+  }
+
   int32_t lp, hp;
   int32_t state;
   uint16_t coeff;
 };
 
+/*
+ * Two pole multimode state variable filter based on trapezoidal integration
+ * (Zavalishin's TPT SVF, in Simper's form), with simultaneous low pass,
+ * band pass, and high pass outputs
+ * - coeff is g = tan(pi*fc/fs) in UQ16, so fc < fs/4. Tables of g can be
+ *   generated with tablegen.py coeff svf.
+ * - damping is R = 1/(2Q) in UQ16, 0xFFFF for Q = 0.5 down to self
+ *   oscillation at 0. Tables over a Q range can be generated with 
+ *   tablegen.py damping.
+ * - Derived coefficients are cached and recomputed (one 32-bit division)
+ *   only when coeff or damping change
+ * - Products are rounded, not truncated, so gain errors from fs/100 to fs/5
+ *   stay within 0.05dB at moderate levels (README 5.13)
+ * - 5 16x16 multiplies per sample, est. ~170 cycles per sample on AVR 
+ *   (~25 per multiply including avr-gcc's helper call, plus loads, adds and
+ *   shifts). Leave input headroom for resonant peaks, around Q times the
+ *   input level.
+ */
+struct TPTSVF16 {
+
+  /*
+   * Constructor
+   */
+  TPTSVF16() : lp(0), bp(0), hp(0), s1(0), s2(0), coeff(0), damping(0xFFFF),
+    a1(0xFFFF), a2(0), a3(0), g_cached(0), r_cached(0xFFFF) {
+    ; // Do nothing
+  }
+
+  /*
+   * Update cached coefficients if coeff or damping have changed
+   * - a1 = 1/(1 + 2Rg + g^2), a2 = g*a1, a3 = g*a2, each in UQ16
+   */
+  void update() {
+    if (coeff == g_cached && damping == r_cached)
+      return;
+    g_cached = coeff;
+    r_cached = damping;
+    uint32_t den = 0x10000 + ((uint32_t)damping * coeff + 0x4000 >> 15) +
+      ((uint32_t)coeff * coeff + 0x8000 >> 16);
+    a1 = den > 0x10000 ? (0xFFFFFFFF - den + (den >> 1) + 1) / den + 1 : 0xFFFF;
+    a2 = (uint32_t)coeff * a1 + 0x8000 >> 16;
+    a3 = (uint32_t)coeff * a2 + 0x8000 >> 16;
+  }
+
+  /*
+   * Process a sample [-0x8000, 0x7FFF]
+   */
+  int16_t process(int16_t sample) {
+    update();
+    int32_t v3 = (int32_t)sample - s2;
+    bp = ((int32_t)a1 * s1 + 0x8000 >> 16) + ((int32_t)a2 * v3 + 0x8000 >> 16);
+    lp = s2 + ((int32_t)a2 * s1 + 0x8000 >> 16) + 
+      ((int32_t)a3 * v3 + 0x8000 >> 16);
+    hp = sample - ((int32_t)damping * bp + 0x4000 >> 15) - lp;
+    s1 = 2 * bp - s1;
+    s2 = 2 * lp - s2;
+    return lp;
+  }
+
+  /*
+   * Process a block of n samples in place
+   */
+  void process_block(int16_t *buf, uint8_t n) {
+    update();
+    int16_t l = lp, b = bp, h = hp, _s1 = s1, _s2 = s2;
+    uint16_t _a1 = a1, _a2 = a2, _a3 = a3, r = damping;
+    for (uint8_t i = 0; i < n; i++) {
+      int32_t v3 = (int32_t)buf[i] - _s2;
+      b = ((int32_t)_a1 * _s1 + 0x8000 >> 16) + 
+        ((int32_t)_a2 * v3 + 0x8000 >> 16);
+      l = _s2 + ((int32_t)_a2 * _s1 + 0x8000 >> 16) + 
+        ((int32_t)_a3 * v3 + 0x8000 >> 16);
+      h = buf[i] - ((int32_t)r * b + 0x4000 >> 15) - l;
+      _s1 = 2 * b - _s1;
+      _s2 = 2 * l - _s2;
+      buf[i] = l;
+    }
+    lp = l;
+    bp = b;
+    hp = h;
+    s1 = _s1;
+    s2 = _s2;
+  }
+
+  /*
+   * Data
+   */
+  int16_t lp, bp, hp;       // Low pass, band pass, and high pass outputs
+  int16_t s1, s2;           // Integrator states
+  uint16_t coeff;           // g = tan(pi*fc/fs), UQ16
+  uint16_t damping;         // R = 1/(2Q), UQ16
+  uint16_t a1, a2, a3;      // Cached coefficients
+  uint16_t g_cached;        // coeff the cache was computed for
+  uint16_t r_cached;        // damping the cache was computed for
+};
+
+/*
+ * Trapezoidal state variable filter, low-frequency extension
+ * - Use instead of TPTSVF16 for low cutoffs, where UQ16 coefficients 
+ *   quantize the cutoff and 16-bit states truncate small updates
+ *    - Stores states in Q32 and cached coefficients in UQ32, multiplying
+ *      with 64-bit products as OnePole16_LF does
+ *    - 64-bit multiplies are library calls on AVR, several times the cost
+ *      of TPTSVF16 per sample, and coefficient updates use a 64-bit division
+ */
+struct TPTSVF16_LF {
+
+  /*
+   * Constructor
+   */
+  TPTSVF16_LF() : lp(0), bp(0), hp(0), s1(0), s2(0), coeff(0), 
+    damping(0xFFFF), a1(0xFFFFFFFF), a2(0), a3(0), g_cached(0), 
+    r_cached(0xFFFF) {
+    ; // Do nothing
+  }
+
+  /*
+   * Update cached coefficients if coeff or damping have changed
+   */
+  void update() {
+    if (coeff == g_cached && damping == r_cached)
+      return;
+    g_cached = coeff;
+    r_cached = damping;
+    uint64_t den = (1ULL << 32) + ((uint64_t)damping * coeff << 1) + 
+      (uint64_t)coeff * coeff;
+    a1 = den > (1ULL << 32) ? 0xFFFFFFFFFFFFFFFFULL / den : 0xFFFFFFFF;
+    a2 = (uint64_t)coeff * a1 >> 16;
+    a3 = (uint64_t)coeff * a2 >> 16;
+  }
+
+  /*
+   * Process a sample [-0x8000, 0x7FFF]
+   */
+  int16_t process(int16_t sample) {
+    update();
+    int64_t v3 = ((int64_t)sample << 16) - s2;
+    bp = ((int64_t)a1 * s1 >> 32) + ((int64_t)a2 * v3 >> 32);
+    lp = s2 + ((int64_t)a2 * s1 >> 32) + ((int64_t)a3 * v3 >> 32);
+    hp = ((int32_t)sample << 16) - ((int64_t)damping * bp >> 15) - lp;
+    s1 = 2 * bp - s1;
+    s2 = 2 * lp - s2;
+    return lp >> 16;
+  }
+
+  /*
+   * Process a block of n samples in place
+   */
+  void process_block(int16_t *buf, uint8_t n) {
+    update();
+    int32_t l = lp, b = bp, h = hp, _s1 = s1, _s2 = s2;
+    uint32_t _a1 = a1, _a2 = a2, _a3 = a3;
+    uint16_t r = damping;
+    for (uint8_t i = 0; i < n; i++) {
+      int64_t v3 = ((int64_t)buf[i] << 16) - _s2;
+      b = ((int64_t)_a1 * _s1 >> 32) + ((int64_t)_a2 * v3 >> 32);
+      l = _s2 + ((int64_t)_a2 * _s1 >> 32) + ((int64_t)_a3 * v3 >> 32);
+      h = ((int32_t)buf[i] << 16) - ((int64_t)r * b >> 15) - l;
+      _s1 = 2 * b - _s1;
+      _s2 = 2 * l - _s2;
+      buf[i] = l >> 16;
+    }
+    lp = l;
+    bp = b;
+    hp = h;
+    s1 = _s1;
+    s2 = _s2;
+  }
+
+  /*
+   * Data
+   */
+  int32_t lp, bp, hp;       // Outputs in Q32 (use >> 16 for Q16)
+  int32_t s1, s2;           // Integrator states
+  uint16_t coeff;           // g = tan(pi*fc/fs), UQ16
+  uint16_t damping;         // R = 1/(2Q), UQ16
+  uint32_t a1, a2, a3;      // Cached coefficients, UQ32
+  uint16_t g_cached;        // coeff the cache was computed for
+  uint16_t r_cached;        // damping the cache was computed for
+};
+
+/*
+ * Four pole (24dB/octave) ladder low pass filter, built from four 
+ * TPTOnePole16 stages with global resonance feedback through a saturator
+ * - coeff is each stage's TPTOnePole16 coefficient g/(1+g) in UQ16, with 
+ *   g = tan(pi*fc/fs). Keep it below 0x8000 (fc < fs/4) so stage states are
+ *   bounded.
+ * - res is the feedback gain k in UQ3.13. Self oscillation starts at 4 
+ *   (0x8000), its level limited by the saturator. Passband gain falls as 
+ *   1/(1+k).
+ * - Stage updates are rounded, but below ~fs/200 the 16-bit stage states
+ *   still lose updates under half an LSB, so low cutoffs need a large input
+ *   (an amplitude 250 sine at fs/500 doesn't pass)
+ * - The feedback is resolved without a unit delay (zero delay feedback):
+ *   the stage input is solved for linearly, then saturated, so resonance
+ *   and cutoff stay in tune up to fs/4
+ * - Saturator: cubic soft clip x - 4x^3/27, reaching 1 with zero slope at
+ *   |x| = 1.5, within 0.11 of tanh(x)
+ * - 13 16x16 multiplies per sample, with two cached coefficients 
+ *   recomputed (one 32-bit division) only when coeff or res change
+ */
+struct Ladder16 {
+
+  /*
+   * Constructor
+   */
+  Ladder16() : lp(0), s(), coeff(0), res(0), w(), d(0x8000), c_cached(0),
+    r_cached(0) {
+    w[3] = 0xFFFF;
+  }
+
+  /*
+   * Update cached coefficients if coeff or res have changed
+   * - Weights w[i] = G^(3-i) * (1-G) of stage states in the output (UQ16)
+   * - d = 1/(1 + k*G^4) in UQ1.15
+   */
+  void update() {
+    if (coeff == c_cached && res == r_cached)
+      return;
+    c_cached = coeff;
+    r_cached = res;
+    uint16_t g2 = (uint32_t)coeff * coeff >> 16;
+    uint16_t g4 = (uint32_t)g2 * g2 >> 16;
+    w[3] = ~coeff;
+    w[2] = (uint32_t)w[3] * coeff >> 16;
+    w[1] = (uint32_t)w[2] * coeff >> 16;
+    w[0] = (uint32_t)w[1] * coeff >> 16;
+    d = ((uint32_t)1 << 31) / (0x10000 + ((uint32_t)res * g4 >> 13));
+  }
+
+  /*
+   * Cubic soft clip of a Q3.13 input to a Q15 output
+   */
+  static int16_t saturate(int32_t x) {
+    if (x >= 12288)
+      return 0x7FFF;
+    if (x <= -12288)
+      return -0x7FFF;
+    int16_t x2 = (int32_t)x * x >> 13;          // x^2, Q13
+    int16_t t = 0x2000 - ((int32_t)x2 * 9709 >> 16);   // 1 - 4x^2/27, Q13
+    int32_t y = (int32_t)x * t >> 11;
+    return y > 0x7FFF ? 0x7FFF : y;
+  }
+
+  /*
+   * Process a sample [-0x8000, 0x7FFF]
+   */
+  int16_t process(int16_t sample) {
+    update();
+    int32_t sum = ((int32_t)w[0] * s[0] + (int32_t)w[1] * s[1] +
+      (int32_t)w[2] * s[2] + (int32_t)w[3] * s[3]) >> 16;
+    int32_t x = sample - ((int32_t)res * sum >> 13);
+    if (x > 0x1FFFF)            // Saturates regardless, as d > 2/3
+      x = 0x1FFFF;
+    else if (x < -0x20000)
+      x = -0x20000;
+    int16_t y = saturate((x >> 2) * d >> 15);
+    for (uint8_t i = 0; i < 4; i++) {
+      int16_t v = (int32_t)coeff * (y - s[i]) + 0x8000 >> 16;
+      y = v + s[i];
+      s[i] = y + v;
+    }
+    lp = y;
+    return lp;
+  }
+
+  /*
+   * Process a block of n samples in place
+   */
+  void process_block(int16_t *buf, uint8_t n) {
+    for (uint8_t i = 0; i < n; i++)
+      buf[i] = process(buf[i]);
+  }
+
+  /*
+   * Data
+   */
+  int16_t lp;               // Output
+  int16_t s[4];             // Stage states
+  uint16_t coeff;           // Stage coefficient g/(1+g), UQ16
+  uint16_t res;             // Feedback gain k, UQ3.13
+  uint16_t w[4];            // Cached weights of stage states in the output
+  uint16_t d;               // Cached 1/(1 + k*G^4), UQ1.15
+  uint16_t c_cached;        // coeff the cache was computed for
+  uint16_t r_cached;        // res the cache was computed for
+};
+
+/*
+ * Envelope follower: one-pole smoothing of the rectified input, with
+ * separate attack (rising) and release (falling) coefficients
+ * - UQ16 output, 0xFFFE for a full scale input
+ * - attack and release are UQ16 coefficients as in OnePole16, up to 0xFFFF.
+ *   With attack = 0xFFFF it's a peak detector, releasing at the release
+ *   rate.
+ * - The level is kept in UQ15.16, as OnePole16_LF keeps Q32, so slow 
+ *   release coefficients still decay to zero
+ * - One 16x16 multiply per sample (est. ~45 cycles on AVR)
+ */
+struct EnvFollower16 {
+
+  /*
+   * Constructor
+   */
+  EnvFollower16() : acc(0), env(0), attack(0x4000), release(0x0040) {
+    ; // Do nothing
+  }
+
+  /*
+   * Process a sample [-0x8000, 0x7FFF], returning the envelope
+   */
+  uint16_t process(int16_t sample) {
+    uint16_t rect = sample < 0 ? (sample == -0x8000 ? 0x7FFF : -sample) : sample;
+    int16_t diff = rect - (uint16_t)(acc >> 16);
+    acc += (int32_t)diff * (diff > 0 ? attack : release);
+    env = (uint16_t)(acc >> 16) << 1;
+    return env;
+  }
+
+  /*
+   * Process a block of n input samples, writing envelope samples to out
+   */
+  void process_block(const int16_t *in, uint16_t *out, uint8_t n) {
+    for (uint8_t i = 0; i < n; i++)
+      out[i] = process(in[i]);
+  }
+
+  /*
+   * Data
+   */
+  uint32_t acc;       // Level in UQ15.16
+  uint16_t env;       // Current output, UQ16
+  uint16_t attack;    // Coefficient while rising
+  uint16_t release;   // Coefficient while falling
+};
+
+/*
+ * RMS detector: running mean square of the input by exponential moving 
+ * average, with a square root on demand
+ * - The average's time constant is 2^SHIFT samples, updated with a shift
+ *   rather than a multiply. SHIFT is a template parameter so the shift is a
+ *   constant; a runtime shift compiles to a loop of one bit per pass on AVR.
+ * - Per sample: one 16x16 square, a 32-bit subtract, shift, and add (est.
+ *   ~40 cycles on AVR for SHIFT = 8, where the shift is a byte move)
+ * - rms() takes a square root (usqrt32, est. ~250 cycles on AVR), so call
+ *   it at control rate, e.g. every 32 samples with ControlRate
+ */
+template <uint8_t SHIFT>
+struct RMS16 {
+
+  static_assert(SHIFT >= 1 && SHIFT <= 16, "RMS16 needs 1 <= SHIFT <= 16");
+
+  /*
+   * Constructor
+   */
+  RMS16() : ms(0) {
+    ; // Do nothing
+  }
+
+  /*
+   * Process a sample [-0x8000, 0x7FFF]
+   */
+  void process(int16_t sample) {
+    uint32_t sq = (int32_t)sample * sample;     // UQ30
+    ms += (int32_t)(sq - ms) >> SHIFT;
+  }
+
+  /*
+   * Process a block of n samples
+   */
+  void process_block(const int16_t *buf, uint8_t n) {
+    uint32_t m = ms;
+    for (uint8_t i = 0; i < n; i++) {
+      uint32_t sq = (int32_t)buf[i] * buf[i];
+      m += (int32_t)(sq - m) >> SHIFT;
+    }
+    ms = m;
+  }
+
+  /*
+   * Get the RMS level in UQ16 (0xFFFE for a full scale square wave)
+   */
+  uint16_t rms() {
+    uint16_t r = usqrt32(ms);                   // UQ15
+    return r > 0x7FFF ? 0xFFFF : r << 1;
+  }
+
+  /*
+   * Data
+   */
+  uint32_t ms;        // Mean square, UQ30
+};
+
+/*
+ * Signed 16-bit biquad filter, direct form 1 with first-order error feedback
+ * - Q2.14 coefficients {b0, b1, b2, a1, a2} (a0 = 1) for any second order 
+ *   response, e.g. low pass, high pass, band pass, or notch coefficient sets
+ *   generated by tablegen.py biquad
+ * - Products are summed in a 32-bit accumulator, and the fraction truncated
+ *   from each output is added back to the next. This shapes the rounding 
+ *   noise away from DC, so low cutoff/high gain filters don't amplify it or 
+ *   stick in limit cycles.
+ * - Outputs are saturated; leave input headroom for resonant peaks
+ * - Cutoffs below ~fs/200 are limited by coefficient resolution, not 
+ *   stability
+ */
+struct Biquad16 {
+
+  /*
+   * Constructor (passes input through until coefficients are set)
+   */
+  Biquad16() : x1(0), x2(0), y1(0), y2(0), err(0), b0(0x4000), b1(0), b2(0),
+    a1(0), a2(0) {
+    ; // Do nothing
+  }
+
+  /*
+   * Load a coefficient set {b0, b1, b2, a1, a2} from program memory, e.g.
+   *   lpf.load(biquad_lp_s16x128 + 5 * idx)
+   */
+  void load(const int16_t *coeffs) {
+    b0 = pgm_read_word(coeffs);
+    b1 = pgm_read_word(coeffs + 1);
+    b2 = pgm_read_word(coeffs + 2);
+    a1 = pgm_read_word(coeffs + 3);
+    a2 = pgm_read_word(coeffs + 4);
+  }
+
+  /*
+   * Process a sample [-0x8000, 0x7FFF]
+   */
+  int16_t process(int16_t sample) {
+    int32_t acc = (int32_t)b0 * sample + (int32_t)b1 * x1 + (int32_t)b2 * x2
+      - (int32_t)a1 * y1 - (int32_t)a2 * y2 + err;
+    err = acc & 0x3FFF;   // Fraction truncated by the shift below
+    acc >>= 14;
+    x2 = x1;
+    x1 = sample;
+    y2 = y1;
+    y1 = acc > 0x7FFF ? 0x7FFF : acc < -0x8000 ? -0x8000 : acc;
+    return y1;
+  }
+
+  /*
+   * Process a block of n samples in place
+   */
+  void process_block(int16_t *buf, uint8_t n) {
+    int16_t _x1 = x1, _x2 = x2, _y1 = y1, _y2 = y2;
+    uint16_t e = err;
+    for (uint8_t i = 0; i < n; i++) {
+      int32_t acc = (int32_t)b0 * buf[i] + (int32_t)b1 * _x1 
+        + (int32_t)b2 * _x2 - (int32_t)a1 * _y1 - (int32_t)a2 * _y2 + e;
+      e = acc & 0x3FFF;
+      acc >>= 14;
+      _x2 = _x1;
+      _x1 = buf[i];
+      _y2 = _y1;
+      _y1 = acc > 0x7FFF ? 0x7FFF : acc < -0x8000 ? -0x8000 : acc;
+      buf[i] = _y1;
+    }
+    x1 = _x1;
+    x2 = _x2;
+    y1 = _y1;
+    y2 = _y2;
+    err = e;
+  }
+
+  /*
+   * Data
+   */
+  int16_t x1, x2;           // Previous inputs
+  int16_t y1, y2;           // Previous outputs
+  uint16_t err;             // Fraction of the last output, UQ14
+  int16_t b0, b1, b2;       // Feedforward coefficients, Q2.14
+  int16_t a1, a2;           // Feedback coefficients, Q2.14
+};
+
 #endif
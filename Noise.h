@@ -0,0 +1,203 @@
+/*
+ * Noise.h
+ *
+ * UQ16 white and pink noise generators. Each renders a sample per call like
+ * Phasor16, in a few cycles and without Arduino random().
+ *
+ * Copyright (C) 2021 Jeff Gregorio
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NOISE_H
+#define NOISE_H
+
+/* 16-bit Galois LFSR white noise
+ *  Binary (0 or 0xFFFF) noise from one step of a maximal length 16-bit
+ *  linear feedback shift register, x^16 + x^14 + x^13 + x^11 + 1
+ *    - Period 2^16-1 samples (6.5s at fs = 10kHz), flat spectrum
+ *    - One shift and a masked 16-bit XOR per sample, without branches
+ */
+struct NoiseLFSR16 {
+
+    /*
+     * Constructor with optional nonzero seed
+     */
+    NoiseLFSR16(uint16_t seed = 0xACE1) : state(seed ? seed : 1), sample(0) {
+        ; // Do nothing
+    }
+
+    /*
+     * Render a noise sample
+     */
+    uint16_t render() {
+        uint16_t mask = -(state & 1);   // Output bit, extended to 16
+        state = (state >> 1) ^ (mask & 0xB400);
+        sample = mask;
+        return sample;
+    }
+
+    /*
+     * Render a block of n noise samples
+     */
+    void render_block(uint16_t *out, uint8_t n) {
+        for (uint8_t i = 0; i < n; i++)
+            out[i] = render();
+    }
+
+    /*
+     * Data
+     */
+    uint16_t state;     // Shift register, never zero
+    uint16_t sample;    // Current output
+};
+
+/* 32-bit Galois LFSR white noise
+ *  NoiseLFSR16 with a 32-bit register, x^32 + x^22 + x^2 + x + 1
+ *    - Period 2^32-1 samples (5 days at fs = 10kHz)
+ */
+struct NoiseLFSR32 {
+
+    /*
+     * Constructor with optional nonzero seed
+     */
+    NoiseLFSR32(uint32_t seed = 0xACE1ACE1) : state(seed ? seed : 1), sample(0) {
+        ; // Do nothing
+    }
+
+    /*
+     * Render a noise sample
+     */
+    uint16_t render() {
+        uint32_t mask = -(state & 1);   // Output bit, extended to 32
+        state = (state >> 1) ^ (mask & 0x80200003);
+        sample = mask;
+        return sample;
+    }
+
+    /*
+     * Render a block of n noise samples
+     */
+    void render_block(uint16_t *out, uint8_t n) {
+        for (uint8_t i = 0; i < n; i++)
+            out[i] = render();
+    }
+
+    /*
+     * Data
+     */
+    uint32_t state;     // Shift register, never zero
+    uint16_t sample;    // Current output
+};
+
+/* 16-bit xorshift white noise
+ *  Uniformly distributed noise from a 16-bit xorshift generator with
+ *  shifts (7, 9, 8)
+ *    - Period 2^16-1 samples, each value in [1, 2^16-1] once per period
+ *    - Three shift-XORs per sample; the shift by 8 is a byte move on AVR
+ */
+struct NoiseXorshift16 {
+
+    /*
+     * Constructor with optional nonzero seed
+     */
+    NoiseXorshift16(uint16_t seed = 0xACE1) : state(seed ? seed : 1) {
+        ; // Do nothing
+    }
+
+    /*
+     * Render a noise sample
+     */
+    uint16_t render() {
+        state ^= state << 7;
+        state ^= state >> 9;
+        state ^= state << 8;
+        return state;
+    }
+
+    /*
+     * Render a block of n noise samples
+     */
+    void render_block(uint16_t *out, uint8_t n) {
+        uint16_t s = state;
+        for (uint8_t i = 0; i < n; i++) {
+            s ^= s << 7;
+            s ^= s >> 9;
+            s ^= s << 8;
+            out[i] = s;
+        }
+        state = s;
+    }
+
+    /*
+     * Data
+     */
+    uint16_t state;     // Generator state and current output, never zero
+};
+
+/* Voss-McCartney pink noise
+ *  Sum of 8 white noise rows, row k held for 2^(k+1) samples, plus a white
+ *  row updated every sample. Only one held row changes per sample (chosen
+ *  by the trailing zeros of a counter), so the sum is updated by difference.
+ *    - -3dB/octave within 1dB over octave bands from fs/512 to fs/2 (host 
+ *      test, test_noise)
+ *    - At most two xorshift steps per sample: one for the white row and,
+ *      on 255 of 256 samples, one for the held row, found by a trailing 
+ *      zero count of one loop pass on average
+ */
+struct NoisePink16 {
+
+    /*
+     * Constructor with optional nonzero seed
+     */
+    NoisePink16(uint16_t seed = 0xACE1) : white(seed), rows(), sum(0),
+        count(0), sample(0x8000) {
+        ; // Do nothing
+    }
+
+    /*
+     * Render a noise sample
+     */
+    uint16_t render() {
+        if (++count) {
+            uint8_t k = 0;
+            for (uint8_t c = count; !(c & 1); c >>= 1)
+                k++;
+            int16_t r = (int16_t)white.render() >> 4;
+            sum += r - rows[k];
+            rows[k] = r;
+        }
+        sample = 0x8000 + sum + ((int16_t)white.render() >> 4);
+        return sample;
+    }
+
+    /*
+     * Render a block of n noise samples
+     */
+    void render_block(uint16_t *out, uint8_t n) {
+        for (uint8_t i = 0; i < n; i++)
+            out[i] = render();
+    }
+
+    /*
+     * Data
+     */
+    NoiseXorshift16 white;  // Source for all rows
+    int16_t rows[8];        // Held rows, each in [-2^11, 2^11)
+    int16_t sum;            // Sum of held rows
+    uint8_t count;          // Sample counter selecting the row to update
+    uint16_t sample;        // Current output
+};
+
+#endif
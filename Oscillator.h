@@ -22,6 +22,9 @@
 #ifndef OSCILLATOR_H
 #define OSCILLATOR_H
 
+#include "FixedPoint.h"
+#include "PgmTable.h"
+
 /* 16-bit Fixed Point phasor
 /*  - Periodic ramp (phase accumulator) in range [0, 2*pi] = [0, 2^16-1]
  *  - Normalized frequency range [-pi, pi] = [-2^15, 2^15-1]
@@ -44,6 +47,22 @@ struct Phasor16 {
         return phasor;
     }
 
+    /*
+     * Render a block of n naive sawtooth samples
+     */
+    void render_block(uint16_t *out, uint8_t n) {
+        uint16_t p = phase;
+        uint16_t q = phasor;
+        int16_t f = freq;
+        for (uint8_t i = 0; i < n; i++) {
+            q = p;
+            out[i] = q;
+            p += f;
+        }
+        phasor = q;
+        phase = p;
+    }
+
     /*
      * Data
      */
@@ -56,13 +75,19 @@ struct Phasor16 {
 /* Wavetable oscillator
  *  Wave table lookup using a Phasor16's output scaled to the table length via
  *  right shift of specified length
+ *    - Reads the table through the memory access policy Mem (see PgmTable.h),
+ *      e.g. MemWavetable16<MemRam> for a table in SRAM. Wavetable16 reads 
+ *      PROGMEM.
  */
-struct Wavetable16 : public Phasor16 {
+template <typename Mem>
+struct MemWavetable16 : public Phasor16 {
+
+    typedef typename Mem::addr_t addr_t;
 
     /*
      * Constructor for user-provided table and right shift length
      */
-    Wavetable16(uint16_t *table, uint8_t shift) : Phasor16(), table(table), shift(shift) {
+    MemWavetable16(addr_t table, uint8_t shift) : Phasor16(), table(table), shift(shift) {
         ; // Do nothing
     }
 
@@ -70,17 +95,920 @@ struct Wavetable16 : public Phasor16 {
      * Render a sample from the wavetable
      */
     uint16_t render() {
-        sample = (uint16_t)pgm_read_ptr(&table[0] + (phasor >> shift));
+        sample = Mem::read(table, phasor >> shift);
+        Phasor16::render();
+        return sample;
+    }
+
+    /*
+     * Render a block of n samples from the wavetable
+     */
+    void render_block(uint16_t *out, uint8_t n) {
+        addr_t t = table;
+        uint8_t sh = shift;
+        uint16_t p = phase;
+        uint16_t q = phasor;
+        uint16_t s = sample;
+        int16_t f = freq;
+        for (uint8_t i = 0; i < n; i++) {
+            s = Mem::read(t, q >> sh);
+            out[i] = s;
+            q = p;
+            p += f;
+        }
+        sample = s;
+        phasor = q;
+        phase = p;
+    }
+
+    /*
+     * Data
+     */
+    addr_t table;
+    uint8_t shift;
+    uint16_t sample;
+};
+
+typedef MemWavetable16<ProgmemNear> Wavetable16;
+
+/* Linear interpolating wavetable oscillator
+ *  Blends adjacent table entries using the phasor bits Wavetable16 discards
+ *  as the weight, lowering truncation spurs so a shorter table reaches the
+ *  same SNR. Costs a second table read, a compare, and a UQ16 multiply per
+ *  sample (~2.5x Wavetable16 on host, est. +30 cycles on AVR).
+ *    - SNR vs. ideal sine, f = [0.001, 0.1] fs (host, libag_bench)
+ *      Wavetable16, sine_u16x256:          41 dB
+ *      Wavetable16, sine_u16x1024:         53 dB
+ *      Wavetable16_Interp, sine_u16x256:   89 dB (1.5KB less flash)
+ *      Wavetable16_Interp, sine_u16x1024:  97 dB
+ *    - Reads through the memory access policy Mem, as MemWavetable16
+ */
+template <typename Mem>
+struct MemWavetable16_Interp : public MemWavetable16<Mem> {
+
+    typedef typename Mem::addr_t addr_t;
+
+    /*
+     * Constructor for user-provided table and right shift length
+     */
+    MemWavetable16_Interp(addr_t table, uint8_t shift) : 
+        MemWavetable16<Mem>(table, shift), mask(0xFFFF >> shift) {
+        ; // Do nothing
+    }
+
+    /*
+     * Render an interpolated sample from the wavetable
+     */
+    uint16_t render() {
+        this->sample = interp(this->phasor);
         Phasor16::render();
+        return this->sample;
+    }
+
+    /*
+     * Render a block of n interpolated samples from the wavetable
+     */
+    void render_block(uint16_t *out, uint8_t n) {
+        uint16_t p = this->phase;
+        uint16_t q = this->phasor;
+        uint16_t s = this->sample;
+        int16_t f = this->freq;
+        for (uint8_t i = 0; i < n; i++) {
+            s = interp(q);
+            out[i] = s;
+            q = p;
+            p += f;
+        }
+        this->sample = s;
+        this->phasor = q;
+        this->phase = p;
+    }
+
+    /*
+     * Interpolate between entries idx and idx+1 (wrapping) with UQ16 weight
+     * - Difference is taken as unsigned in whichever direction is positive,
+     *   so tables with full-scale steps (e.g. sawtooth) interpolate exactly
+     */
+    uint16_t interp(uint16_t ph) {
+        uint8_t sh = this->shift;
+        uint16_t idx = ph >> sh;
+        uint16_t w = ph << (16 - sh);
+        uint16_t s0 = Mem::read(this->table, idx);
+        uint16_t s1 = Mem::read(this->table, (idx + 1) & mask);
+        if (s1 >= s0)
+            return s0 + qmul16((uint16_t)(s1 - s0), w);
+        else
+            return s0 - qmul16((uint16_t)(s0 - s1), w);
+    }
+
+    /*
+     * Data
+     */
+    uint16_t mask;  // Table length - 1
+};
+
+typedef MemWavetable16_Interp<ProgmemNear> Wavetable16_Interp;
+
+/* 32-bit Fixed Point phasor
+ *  Phasor16 with a 32-bit phase and 16.16 frequency, for sub-Hz LFOs and 
+ *  fine tuning. The phasor output is the top 16 bits of the phase, so it 
+ *  reads tables exactly as Phasor16 does.
+ *    - Phase range [0, 2*pi] = [0, 2^32-1]
+ *    - Normalized frequency range [-pi, pi] = [-2^31, 2^31-1], i.e. a 
+ *      Phasor16 frequency << 16
+ *    - Frequency step at fs = 10kHz: 2.3uHz (Phasor16: 0.15Hz)
+ *    - Cost of render(), AVR: est. 32 cycles (Phasor16: 18), counted from 
+ *      the loads, stores, and adds, not measured
+ */
+struct Phasor32 {
+
+    // Constructor
+    Phasor32() : phase(0), freq(0), phasor(0) {
+        ; // Do nothing
+    }
+
+    /*
+     * Render a naive sawtooth sample
+     */
+    uint16_t render() {
+        phasor = phase >> 16;
+        phase += freq;
+        return phasor;
+    }
+
+    /*
+     * Render a block of n naive sawtooth samples
+     */
+    void render_block(uint16_t *out, uint8_t n) {
+        uint32_t p = phase;
+        uint16_t q = phasor;
+        int32_t f = freq;
+        for (uint8_t i = 0; i < n; i++) {
+            q = p >> 16;
+            out[i] = q;
+            p += f;
+        }
+        phasor = q;
+        phase = p;
+    }
+
+    /*
+     * Data
+     */
+    uint32_t phase;         // Phase accumulator in [0, 2^32]
+    int32_t freq;           // Phase increment in [-2^31, 2^31-1]
+    uint16_t phasor;        // Naive sawtooth 
+};
+
+/* 24-bit Fixed Point phasor
+ *  Phasor32 carrying only 24 bits of phase, with 16.8 frequency. AVR adds
+ *  are one instruction per byte, so this keeps most of the precision gain
+ *  for 3/4 of the cost.
+ *    - Phase range [0, 2*pi] = [0, 2^24-1]
+ *    - Normalized frequency range [-pi, pi] = [-2^23, 2^23-1], i.e. a 
+ *      Phasor16 frequency << 8
+ *    - Frequency step at fs = 10kHz: 0.6mHz
+ *    - Cost of render(), AVR: est. 25 cycles, counted as for Phasor32
+ *  Uses avr-gcc's native 24-bit integers. Elsewhere the phase is stored in
+ *  32 bits, whose low 24 bits wrap identically.
+ */
+#ifdef __AVR__
+typedef __uint24 phase24_t;
+typedef __int24 freq24_t;
+#else
+typedef uint32_t phase24_t;
+typedef int32_t freq24_t;
+#endif
+
+struct Phasor24 {
+
+    // Constructor
+    Phasor24() : phase(0), freq(0), phasor(0) {
+        ; // Do nothing
+    }
+
+    /*
+     * Render a naive sawtooth sample
+     */
+    uint16_t render() {
+        phasor = phase >> 8;
+        phase += freq;
+        return phasor;
+    }
+
+    /*
+     * Render a block of n naive sawtooth samples
+     */
+    void render_block(uint16_t *out, uint8_t n) {
+        phase24_t p = phase;
+        uint16_t q = phasor;
+        freq24_t f = freq;
+        for (uint8_t i = 0; i < n; i++) {
+            q = p >> 8;
+            out[i] = q;
+            p += f;
+        }
+        phasor = q;
+        phase = p;
+    }
+
+    /*
+     * Data
+     */
+    phase24_t phase;        // Phase accumulator in [0, 2^24]
+    freq24_t freq;          // Phase increment in [-2^23, 2^23-1]
+    uint16_t phasor;        // Naive sawtooth
+};
+
+/* 32-bit phase wavetable oscillator
+ *  Wavetable16 driven by a Phasor32. The lookup costs the same as 
+ *  Wavetable16's, so only the phase update is more expensive (est. +14 
+ *  cycles on AVR, counted as for Phasor32, not measured).
+ */
+struct Wavetable32 : public Phasor32 {
+
+    /*
+     * Constructor for user-provided table and right shift length
+     */
+    Wavetable32(const uint16_t *table, uint8_t shift) : Phasor32(), table(table), shift(shift) {
+        ; // Do nothing
+    }
+
+    /*
+     * Render a sample from the wavetable
+     */
+    uint16_t render() {
+        sample = pgm_read_word(table + (phasor >> shift));
+        Phasor32::render();
+        return sample;
+    }
+
+    /*
+     * Render a block of n samples from the wavetable
+     */
+    void render_block(uint16_t *out, uint8_t n) {
+        const uint16_t *t = table;
+        uint8_t sh = shift;
+        uint32_t p = phase;
+        uint16_t q = phasor;
+        uint16_t s = sample;
+        int32_t f = freq;
+        for (uint8_t i = 0; i < n; i++) {
+            s = pgm_read_word(t + (q >> sh));
+            out[i] = s;
+            q = p >> 16;
+            p += f;
+        }
+        sample = s;
+        phasor = q;
+        phase = p;
+    }
+
+    /*
+     * Data
+     */
+    const uint16_t *table;
+    uint8_t shift;
+    uint16_t sample;
+};
+
+/* 24-bit phase wavetable oscillator
+ *  Wavetable16 driven by a Phasor24 (est. +7 cycles on AVR over 
+ *  Wavetable16, counted as for Phasor24, not measured)
+ */
+struct Wavetable24 : public Phasor24 {
+
+    /*
+     * Constructor for user-provided table and right shift length
+     */
+    Wavetable24(const uint16_t *table, uint8_t shift) : Phasor24(), table(table), shift(shift) {
+        ; // Do nothing
+    }
+
+    /*
+     * Render a sample from the wavetable
+     */
+    uint16_t render() {
+        sample = pgm_read_word(table + (phasor >> shift));
+        Phasor24::render();
         return sample;
     }
 
+    /*
+     * Render a block of n samples from the wavetable
+     */
+    void render_block(uint16_t *out, uint8_t n) {
+        const uint16_t *t = table;
+        uint8_t sh = shift;
+        phase24_t p = phase;
+        uint16_t q = phasor;
+        uint16_t s = sample;
+        freq24_t f = freq;
+        for (uint8_t i = 0; i < n; i++) {
+            s = pgm_read_word(t + (q >> sh));
+            out[i] = s;
+            q = p >> 8;
+            p += f;
+        }
+        sample = s;
+        phasor = q;
+        phase = p;
+    }
+
     /*
      * Data
      */
-    uint16_t *table;
+    const uint16_t *table;
     uint8_t shift;
     uint16_t sample;
 };
 
+/* Band-limited wavetable set
+ *  Wavetable oscillator over a set of 8 tables generated by 
+ *  'tablegen.py blset', each band-limited for one octave of frequency, 
+ *  stored consecutively. The table is chosen from |freq| by a lookup on its
+ *  high byte, so selection costs the same every sample:
+ *    - Table 0:  |freq| < 2^8
+ *    - Table k:  2^(7+k) <= |freq| < 2^(8+k), k = 1...7
+ */
+struct WavetableSet16 : public Wavetable16 {
+
+    /*
+     * Constructor for user-provided table set and right shift length
+     */
+    WavetableSet16(const uint16_t *tables, uint8_t shift) : Wavetable16(tables, shift), 
+        tables(tables) {
+        ; // Do nothing
+    }
+
+    /*
+     * Render a sample from the table for the current frequency
+     */
+    uint16_t render() {
+        table = tables + ((uint16_t)octave(freq) << (16 - shift));
+        return Wavetable16::render();
+    }
+
+    /*
+     * Render a block of n samples, selecting the table once per block
+     */
+    void render_block(uint16_t *out, uint8_t n) {
+        table = tables + ((uint16_t)octave(freq) << (16 - shift));
+        Wavetable16::render_block(out, n);
+    }
+
+    /*
+     * Table index for a frequency: bit length of |freq| >> 8, saturated at 7
+     */
+    static uint8_t octave(int16_t freq) {
+        static const uint8_t lut[129] PROGMEM = {
+            0, 1, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4,
+            5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+            6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+            7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+            7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+            7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+            7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+            7
+        };
+        int16_t sign = freq >> 15;
+        return pgm_read_byte(lut + ((uint16_t)((uint16_t)(freq ^ sign) - (uint16_t)sign) >> 8));
+    }
+
+    /*
+     * Data
+     */
+    const uint16_t *tables;     // First table in the set
+};
+
+/* Quarter-wave sine oscillator
+ *  Sine from a table of only its first quarter period, generated by 
+ *  'tablegen.py sineqw', unfolding the symmetry from the top two phasor bits:
+ *    - Bit 14 set (2nd and 4th quarters) --> index mirrored, L - idx
+ *    - Bit 15 set (2nd half) --> magnitude subtracted from, not added to, 
+ *      the midpoint
+ *  A table of L+1 entries matches a full-period table of 4L entries for a 
+ *  quarter of the flash (sineqw_u16x256: 514 bytes vs. 2KB for 
+ *  sine_u16x1024), with the shift given as for that full-period table.
+ */
+struct SineQW16 : public Wavetable16 {
+
+    /*
+     * Constructor for user-provided quarter-wave table and right shift length
+     * of the equivalent full-period table (e.g. 6 for sineqw_u16x256)
+     */
+    SineQW16(const uint16_t *table, uint8_t shift) : Wavetable16(table, shift), 
+        mask(0x3FFF >> shift) {
+        ; // Do nothing
+    }
+
+    /*
+     * Render a sample from the quarter-wave table
+     */
+    uint16_t render() {
+        sample = unfold(phasor);
+        Phasor16::render();
+        return sample;
+    }
+
+    /*
+     * Render a block of n samples from the quarter-wave table
+     */
+    void render_block(uint16_t *out, uint8_t n) {
+        uint16_t p = phase;
+        uint16_t q = phasor;
+        uint16_t s = sample;
+        int16_t f = freq;
+        for (uint8_t i = 0; i < n; i++) {
+            s = unfold(q);
+            out[i] = s;
+            q = p;
+            p += f;
+        }
+        sample = s;
+        phasor = q;
+        phase = p;
+    }
+
+    /*
+     * Sine sample at phase ph from the quarter-wave table
+     */
+    uint16_t unfold(uint16_t ph) {
+        uint16_t idx = (ph >> shift) & mask;
+        if (ph & 0x4000)
+            idx = mask + 1 - idx;
+        uint16_t mag = pgm_read_word(table + idx);
+        return (ph & 0x8000) ? 0x8000 - mag : 0x8000 + mag;
+    }
+
+    /*
+     * Data
+     */
+    uint16_t mask;  // Quarter-wave table length - 1
+};
+
+/* Quarter-wave quadrature oscillator
+ *  SineQW16 rendering a cosine alongside the sine, read from the same 
+ *  quarter-wave table at phase + pi/2
+ */
+struct SineQW16_Quad : public SineQW16 {
+
+    /*
+     * Constructor for user-provided quarter-wave table and right shift length
+     */
+    SineQW16_Quad(const uint16_t *table, uint8_t shift) : SineQW16(table, shift), 
+        cosine(0x8000) {
+        ; // Do nothing
+    }
+
+    /*
+     * Render cosine and sine, return sine
+     */
+    uint16_t render() {
+        cosine = unfold(phasor + 0x4000);
+        return SineQW16::render();
+    }
+
+    /*
+     * Render blocks of n sine and n cosine samples
+     */
+    void render_block(uint16_t *out, uint16_t *out_cos, uint8_t n) {
+        uint16_t p = phase;
+        uint16_t q = phasor;
+        uint16_t s = sample;
+        uint16_t c = cosine;
+        int16_t f = freq;
+        for (uint8_t i = 0; i < n; i++) {
+            s = unfold(q);
+            c = unfold(q + 0x4000);
+            out[i] = s;
+            out_cos[i] = c;
+            q = p;
+            p += f;
+        }
+        sample = s;
+        cosine = c;
+        phasor = q;
+        phase = p;
+    }
+
+    /*
+     * Data
+     */
+    uint16_t cosine;    // Current cosine sample
+};
+
+/* Recursive quadrature oscillator
+ *  Table-free sine and cosine from a "magic circle" recursion, 
+ *    x[n+1] = x[n] - e*y[n],  y[n+1] = y[n] + e*x[n+1],  e = 2*sin(w/2)
+ *  which keeps a constant amplitude with no per-sample normalization, 
+ *  unlike the coupled (rotation) form. State is Q15 extended to 32 bits, 
+ *  since 16-bit state loses low frequencies to rounding entirely. 
+ *    - Normalized frequency range [-fs/6, fs/6] = [-0x2AAA, 0x2AAA], with 
+ *      e recomputed (4 multiplies) only when freq changes, frequency step 
+ *      ~fs/2^17.6
+ *    - Amplitude is renormalized every 64 samples against the recursion's
+ *      invariant, x^2 + y^2 - e*x*y
+ *    - Cosine is x[n] - e/2*y[n], exact in phase but low in amplitude by 
+ *      cos(w/2), i.e. 0.05% at fs/100, 1.9% at fs/16
+ *    - vs. Quad16 (sine_u16x1024, 2KB flash, 2 table reads): 
+ *      no flash; 5 16x16 multiplies per sample (est. ~90 cycles on AVR 
+ *      from instruction counts, about 1.5x Quad16, not measured); SNR 
+ *      62-89dB vs. 53dB, rising with frequency (host, f = 0.001-0.17 fs,
+ *      after settling); frequency within 0.3% at fs/1000, 0.005% above 
+ *      fs/64, vs. exact for Quad16
+ */
+struct RecursiveQuad16 {
+
+    /*
+     * Constructor
+     */
+    RecursiveQuad16() : freq(0), sample(0x8000), cosine(0x8000 + 2 * amp), 
+        x((int32_t)amp << 16), y(0), e(0), target((int32_t)amp * amp), 
+        f_cached(0), count(0) {
+        ; // Do nothing
+    }
+
+    /*
+     * Render cosine and sine, return sine
+     */
+    uint16_t render() {
+        update_e();
+        int16_t yh = y >> 16;
+        sample = clip(2 * (int32_t)yh);
+        cosine = clip((x >> 15) - qmul16(e, yh));
+        x -= mul(e, y);
+        y += mul(e, x);
+        if (!(++count & 0x3F))
+            renormalize();
+        return sample;
+    }
+
+    /*
+     * Render blocks of n sine and n cosine samples
+     */
+    void render_block(uint16_t *out, uint16_t *out_cos, uint8_t n) {
+        for (uint8_t i = 0; i < n; i++) {
+            out[i] = render();
+            out_cos[i] = cosine;
+        }
+    }
+
+    /*
+     * Update cached coefficient and amplitude invariant if freq has changed
+     * - e = 2*sin(t), t = pi*freq/2^16, from its Taylor series to t^5
+     */
+    void update_e() {
+        if (freq == f_cached)
+            return;
+        f_cached = freq;
+        int16_t f = freq > 0x2AAA ? 0x2AAA : freq < -0x2AAA ? -0x2AAA : freq;
+        int16_t t = ((int32_t)f * 25736 + 0x2000) >> 14;    // 25736 = pi/4 (Q15)
+        int16_t t2 = qmul16(t, t);
+        int16_t t3 = qmul16(t2, t);
+        int16_t t5 = qmul16(t3, t2);
+        int32_t c = 2 * (int32_t)t - qmul16(t3, (int16_t)10923) + qmul16(t5, (int16_t)546);
+        e = c > 0x7FFF ? 0x7FFF : c < -0x7FFF ? -0x7FFF : c;
+        int16_t ae = qmul16(e, amp) >> 1;
+        target = (int32_t)amp * amp - (int32_t)ae * ae;
+    }
+
+    /*
+     * Scale state toward the invariant's target by a first-order (Newton) 
+     * step, g = 1 + (target - inv)/(2*target)
+     */
+    void renormalize() {
+        int16_t xh = x >> 16;
+        int16_t yh = y >> 16;
+        int32_t inv = (int32_t)xh * xh + (int32_t)yh * yh - (int32_t)qmul16(e, xh) * yh;
+        int32_t d = (target - inv) >> 13;   // (g - 1) * 2^16, as 2*target ~ 2^29
+        x += (int32_t)xh * d;
+        y += (int32_t)yh * d;
+    }
+
+    /*
+     * Offset a signed output to unsigned, clipping the overshoot that can 
+     * follow a large frequency change until renormalization catches up
+     */
+    static uint16_t clip(int32_t v) {
+        return 0x8000 + (v > 0x7FFF ? 0x7FFF : v < -0x8000 ? -0x8000 : v);
+    }
+
+    /*
+     * Q15 coefficient times 32-bit state, from two 16x16 multiplies
+     */
+    static int32_t mul(int16_t c, int32_t v) {
+        return (int32_t)c * (int16_t)(v >> 16) * 2 + (((int32_t)c * (uint16_t)v + 0x4000) >> 15);
+    }
+
+    /*
+     * Data
+     */
+    static const int16_t amp = 0x3FF0;  // Amplitude of x, y (high words)
+    int16_t freq;           // Normalized frequency in [-0x2AAA, 0x2AAA]
+    uint16_t sample;        // Current sine sample
+    uint16_t cosine;        // Current cosine sample
+    int32_t x, y;           // State (Q15 << 16)
+    int16_t e;              // Cached coefficient (Q15)
+    int32_t target;         // Cached invariant for amplitude amp
+    int16_t f_cached;       // freq e was computed for
+    uint8_t count;          // Samples since renormalization
+};
+
+/* PolyBLEP band-limited oscillator base
+ *  Phasor16 with polynomial band-limited step (PolyBLEP) correction. Within
+ *  one sample period (|freq|) of a discontinuity, a 2nd order polynomial 
+ *  residual is added to the naive waveform, attenuating its aliasing at the
+ *  cost of a few multiplies in the samples nearest each step.
+ *    - Harmonic to alias power, f0 = 0.008-0.125 fs (host/test_polyblep)
+ *      Phasor16 (naive saw):   20 - 8 dB
+ *      PolyBLEPSaw16:          36 - 27 dB
+ *      Naive square:           22 - 10 dB
+ *      PolyBLEPSquare16:       38 - 27 dB
+ *    - Residual magnitude (1 - d/|freq|)^2 at phase distance d from a step
+ *    - 1/|freq| is cached and recomputed (one 32-bit division, est. ~600 
+ *      cycles on AVR) only when freq changes, so write freq at control rate
+ *      rather than every sample from a noisy ADC
+ */
+struct PolyBLEP16 : public Phasor16 {
+
+    /*
+     * Constructor
+     */
+    PolyBLEP16() : Phasor16(), sample(0), dt(0), recip(0) {
+        ; // Do nothing
+    }
+
+    /*
+     * Update cached step size and reciprocal if freq has changed
+     */
+    void update_dt() {
+        uint16_t abs_freq = freq < 0 ? -freq : freq;
+        if (abs_freq != dt) {
+            dt = abs_freq;
+            recip = dt ? 0xFFFFFFFF / dt : 0;
+        }
+    }
+
+    /*
+     * UQ16 residual at phase distance d after a step (d = 0 at the step), 
+     * or before a step (d > 0)
+     */
+    uint16_t residual_after(uint16_t d) {
+        if (d >= dt)
+            return 0;
+        uint16_t x = (uint32_t)d * recip >> 16;   // d/dt in UQ16
+        return qmul16((uint16_t)~x, (uint16_t)~x);  // (1 - d/dt)^2
+    }
+    uint16_t residual_before(uint16_t d) {
+        return d ? residual_after(d) : 0;
+    }
+
+    /*
+     * Data
+     */
+    uint16_t sample;    // Current output
+    uint16_t dt;        // Cached |freq|
+    uint32_t recip;     // Cached 2^32/|freq|
+};
+
+/* PolyBLEP sawtooth
+ *  Band-limited version of Phasor16's naive sawtooth
+ */
+struct PolyBLEPSaw16 : public PolyBLEP16 {
+
+    /*
+     * Render a band-limited sawtooth sample
+     */
+    uint16_t render() {
+        update_dt();
+        Phasor16::render();
+        sample = phasor + (residual_after(phasor) >> 1) - 
+            (residual_before(-phasor) >> 1);
+        return sample;
+    }
+};
+
+/* PolyBLEP pulse wave
+ *  Band-limited pulse, high for phases in [0, width), low for [width, 2^16)
+ *  with UQ16 pulse width
+ */
+struct PolyBLEPPulse16 : public PolyBLEP16 {
+
+    /*
+     * Constructor
+     */
+    PolyBLEPPulse16(uint16_t width = 0x8000) : PolyBLEP16(), width(width) {
+        ; // Do nothing
+    }
+
+    /*
+     * Render a band-limited pulse wave sample
+     */
+    uint16_t render() {
+        int32_t s;
+        update_dt();
+        Phasor16::render();
+        uint16_t fall = phasor - width;     // Phase relative to falling edge
+        s = phasor < width ? 0xFFFF : 0;
+        s -= residual_after(phasor) >> 1;   // Rising edge
+        s += residual_before(-phasor) >> 1;
+        s += residual_after(fall) >> 1;     // Falling edge
+        s -= residual_before(-fall) >> 1;
+        sample = s < 0 ? 0 : s > 0xFFFF ? 0xFFFF : s;
+        return sample;
+    }
+
+    /*
+     * Data
+     */
+    uint16_t width;     // Pulse width (UQ16)
+};
+
+/* PolyBLEP square wave
+ *  Band-limited 50% pulse
+ */
+struct PolyBLEPSquare16 : public PolyBLEPPulse16 {
+
+    /*
+     * Constructor
+     */
+    PolyBLEPSquare16() : PolyBLEPPulse16(0x8000) {
+        ; // Do nothing
+    }
+};
+
+/* Phase modulation operator
+ *  Wavetable16 whose lookup phase is offset by a signed modulator input 
+ *  scaled by a modulation index, i.e. sin(phase + 2*pi*index*mod)
+ *    - Modulator input is Q15 in [-1, 1), e.g. a Wavetable16 sample - 2^15
+ *    - Index is UQ4.12 peak phase deviation in periods [0, 16), so an FM
+ *      index (in radians) of B corresponds to B/(2*pi) * 2^12
+ */
+struct PMOperator16 : public Wavetable16 {
+
+    /*
+     * Constructor for user-provided table and right shift length
+     */
+    PMOperator16(const uint16_t *table, uint8_t shift) : Wavetable16(table, shift), 
+        index(0) {
+        ; // Do nothing
+    }
+
+    /*
+     * Render a sample, phase modulated by mod
+     */
+    uint16_t render(int16_t mod) {
+        uint16_t ph = phasor + (uint16_t)(((int32_t)mod * index) >> 11);
+        sample = pgm_read_word(table + (ph >> shift));
+        Phasor16::render();
+        return sample;
+    }
+
+    /*
+     * Render a block of n samples, phase modulated by n inputs in mod
+     */
+    void render_block(uint16_t *out, const int16_t *mod, uint8_t n) {
+        for (uint8_t i = 0; i < n; i++)
+            out[i] = render(mod[i]);
+    }
+
+    /*
+     * Data
+     */
+    uint16_t index;     // Modulation index (UQ4.12 periods)
+};
+
+/* Two-operator phase modulation voice
+ *  A modulator PMOperator16 phase modulating a carrier, for FM-style timbres
+ *  from a sine table at the cost of two table reads per sample. 
+ *    - mod.index sets the modulator's feedback amount (self-modulation by 
+ *      the mean of its last two outputs, which keeps high feedback stable)
+ *    - car.index sets the modulation index
+ *    - Set mod.freq and car.freq independently, e.g. mod.freq = 2*car.freq 
+ *      for a 2:1 ratio
+ *    - Cost per sample, host (libag_bench): render() ~9.5ns, 6-10x 
+ *      Wavetable16::render() (0.9-1.6ns between runs), as the carrier 
+ *      lookup waits on the modulator's. render_block() keeps the state in
+ *      locals and runs at ~5.3ns. AVR: est. ~200 cycles from instruction 
+ *      counts (two lookups, two 16x16 multiplies), not measured
+ */
+struct PMVoice16 {
+
+    /*
+     * Constructor for user-provided sine table and right shift length
+     */
+    PMVoice16(const uint16_t *table, uint8_t shift) : mod(table, shift), 
+        car(table, shift), fb() {
+        ; // Do nothing
+    }
+
+    /*
+     * Render a sample from the carrier
+     */
+    uint16_t render() {
+        int16_t m = ((int32_t)fb[0] + fb[1]) >> 1;
+        fb[1] = fb[0];
+        fb[0] = mod.render(m) - 0x8000;
+        return car.render(fb[0]);
+    }
+
+    /*
+     * Render a block of n samples from the carrier
+     */
+    void render_block(uint16_t *out, uint8_t n) {
+        for (uint8_t i = 0; i < n; i++)
+            out[i] = render();
+    }
+
+    /*
+     * Data
+     */
+    PMOperator16 mod;   // Modulator
+    PMOperator16 car;   // Carrier
+    int16_t fb[2];      // Last two modulator outputs (Q15)
+};
+
+/* Wavetable oscillator bank
+ *  N voices reading one shared table, with phases, frequencies, and output
+ *  samples kept in separate arrays (structure of arrays) and rendered in a
+ *  single loop. Replaces N Wavetable16 objects each carrying its own table
+ *  and shift, so the loop loads only the per-voice state it updates.
+ *    - render() returns the mix, i.e. the sum of voices right shifted by 
+ *      ceil(log2(N)) to stay within 16 bits
+ *    - AVR: est. ~14 fewer cycles per voice than separate Wavetable16s, 
+ *      with no per-voice table, shift, or phasor loads and stores (counted,
+ *      not measured)
+ *    - Host (libag_bench, 8 voices): ~6.8ns per sample, ~6.6ns with
+ *      render_block(), against 10-16ns for 8 separate Wavetable16s, whose
+ *      figure moves with code layout between builds
+ */
+template <uint8_t N>
+struct OscBank {
+
+    /*
+     * Constructor for user-provided table and right shift length
+     */
+    OscBank(const uint16_t *table, uint8_t shift) : phase(), freq(), sample(), 
+        table(table), shift(shift) {
+        ; // Do nothing
+    }
+
+    /*
+     * Render a sample from each voice, return the mix
+     */
+    uint16_t render() {
+        const uint16_t *t = table;
+        uint8_t sh = shift;
+        uint32_t sum = 0;
+        for (uint8_t i = 0; i < N; i++) {
+            uint16_t p = phase[i];
+            phase[i] = p + freq[i];
+            uint16_t s = pgm_read_word(t + (p >> sh));
+            sample[i] = s;
+            sum += s;
+        }
+        return sum >> mix_shift(N);
+    }
+
+    /*
+     * Render a block of n mixed samples
+     * - Voice states are updated in place; each voice's sample is stored 
+     *   only on the last step of the block
+     */
+    void render_block(uint16_t *out, uint8_t n) {
+        if (!n)
+            return;
+        const uint16_t *t = table;
+        uint8_t sh = shift;
+        for (uint8_t j = 1; j < n; j++) {
+            uint32_t sum = 0;
+            for (uint8_t i = 0; i < N; i++) {
+                uint16_t p = phase[i];
+                phase[i] = p + freq[i];
+                sum += pgm_read_word(t + (p >> sh));
+            }
+            *out++ = sum >> mix_shift(N);
+        }
+        *out = render();
+    }
+
+    /*
+     * Right shift scaling the sum of n voices to 16 bits, ceil(log2(n))
+     */
+    static constexpr uint8_t mix_shift(uint8_t n) {
+        return n <= 1 ? 0 : 1 + mix_shift((n + 1) >> 1);
+    }
+
+    /*
+     * Data
+     */
+    uint16_t phase[N];      // Phase accumulators in [0, 2^16]
+    int16_t freq[N];        // Phase increments in [-2^15, 2^15-1]
+    uint16_t sample[N];     // Current sample of each voice
+    const uint16_t *table;  // Shared table
+    uint8_t shift;
+};
+
 #endif
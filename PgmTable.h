@@ -22,18 +22,73 @@
 #ifndef PGMTABLE_H
 #define PGMTABLE_H
 
+#include "FixedPoint.h"
+
 /*
- * Unsigned 16-bit table lookup with UQ16 scaling factor
+ * Memory access policies for 16-bit tables
+ * - Table readers take a policy as a template parameter, so each read
+ *   resolves at compile time to the cheapest access for where the table is:
+ *     - ProgmemNear: PROGMEM in the low 64KB of flash, LPM via pgm_read_word
+ *     - ProgmemFar: PROGMEM anywhere in flash (e.g. above 64KB on the 
+ *       ATmega2560), ELPM via pgm_read_word_far. Tables are addressed by
+ *       pgm_get_far_address(table), since AVR pointers are 16 bits. It only
+ *       compiles inside a function on AVR, so set the address in setup().
+ *       PROGMEM alone doesn't place a table above 64KB.
+ *     - MemRam: SRAM, e.g. tables computed at startup or loaded over SysEx,
+ *       an ordinary LD
+ *     - MemHost: ordinary memory on host builds, read as MemRam. ProgmemNear
+ *       and ProgmemFar also compile on host, through the shim's plain loads.
+ * - Names are prefixed (Progmem, Mem) to stay clear of sketch identifiers
+ * - addr_t is the table address type, read() returns entry idx
  */
-struct PgmTable16 {
+struct ProgmemNear {
+	typedef const uint16_t *addr_t;
+	static uint16_t read(addr_t table, uint16_t idx) {
+		return pgm_read_word(table + idx);
+	}
+};
+
+struct ProgmemFar {
+	typedef uint_farptr_t addr_t;
+	static uint16_t read(addr_t table, uint16_t idx) {
+		return pgm_read_word_far(table + 2 * (uint_farptr_t)idx);
+	}
+};
+
+struct MemRam {
+	typedef const uint16_t *addr_t;
+	static uint16_t read(addr_t table, uint16_t idx) {
+		return table[idx];
+	}
+};
+
+struct MemHost : public MemRam {
+	;	// Same access as MemRam
+};
+
+/*
+ * Unsigned 16-bit table lookup with UQ16 scaling factor, from memory given 
+ * by the access policy Mem (PgmTable16 for PROGMEM tables)
+ * - lookup() and lookup_scale() take an integer index, e.g. a 10-bit ADC
+ *   result into a 1024 entry table
+ * - lookup_interp() and lookup_scale_interp() take a UQ16 index spanning
+ *   the whole table, [0, 0xFFFF] --> [0, length-1], and interpolate linearly
+ *   between adjacent entries. A 64 or 128 entry table then stands in for a 
+ *   1024 entry one, for an extra read and two 16x16 multiplies.
+ */
+template <typename Mem>
+struct MemTable16 {
+
+	typedef typename Mem::addr_t addr_t;
 
 	/*
 	 *  Constructors
 	 */
-	PgmTable16(uint16_t *table) : table(table), scale(0xFFFF) {
+	MemTable16(addr_t table) : table(table), scale(0xFFFF), last(1023) {
 		;	// Do nothing
 	}
-	PgmTable16(uint16_t *table, uint16_t scale) : table(table), scale(scale) {
+	MemTable16(addr_t table, uint16_t scale, uint16_t length = 1024) : 
+		table(table), scale(scale), last(length - 1) {
 		; 	// Do nothing
 	}
 
@@ -41,14 +96,42 @@ struct PgmTable16 {
 	 * 	Table lookup, direct or scaled by UQ16 multiply
 	 */
 	uint16_t lookup(uint16_t idx) {
-		return (uint16_t)pgm_read_ptr(table + idx);
+		return Mem::read(table, idx);
 	}
 	uint16_t lookup_scale(uint16_t idx) {
-		return (uint32_t)scale * (uint16_t)pgm_read_ptr(table + idx) >> 16;
+		return (uint32_t)scale * Mem::read(table, idx) >> 16;
 	}
 
-	uint16_t *table;
+	/*
+	 * 	Interpolated table lookup at a UQ16 index, direct or scaled by UQ16 
+	 * 	multiply
+	 * 	- Difference is taken as unsigned in whichever direction is positive,
+	 * 	  as in Wavetable16_Interp
+	 */
+	uint16_t lookup_interp(uint16_t idx_q16) {
+		uint32_t pos = (uint32_t)idx_q16 * last;	// UQ16.16
+		pos += pos >> 16;							// 0xFFFF --> just below last
+		uint16_t idx = pos >> 16;
+		uint16_t w = pos;
+		uint16_t s0 = Mem::read(table, idx);
+		uint16_t s1 = Mem::read(table, idx + 1);
+		if (s1 >= s0)
+			return s0 + qmul16((uint16_t)(s1 - s0), w);
+		else
+			return s0 - qmul16((uint16_t)(s0 - s1), w);
+	}
+	uint16_t lookup_scale_interp(uint16_t idx_q16) {
+		return (uint32_t)scale * lookup_interp(idx_q16) >> 16;
+	}
+
+	addr_t table;
 	uint16_t scale;
+	uint16_t last;		// Table length - 1
 };
+
+/*
+ * Table lookup from program memory (low 64KB)
+ */
+typedef MemTable16<ProgmemNear> PgmTable16;
  
 #endif
\ No newline at end of file
@@ -50,6 +50,11 @@ Timer1 timer1;
 MIDIDispatcher dispatcher;              
 SoftwareSerial midi_rx(PIN_RX, NULL);   // Software Serial with RX only
 
+/*
+ * User handler prototype (generated by the Arduino IDE, but not by host builds)
+ */
+void note_in(uint8_t ch, uint8_t note, uint8_t vel);
+
 /* 
  *  Setup
  */
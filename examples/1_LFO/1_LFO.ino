@@ -17,6 +17,7 @@
 #include <Oscillator.h>
 #include <PgmTable.h>
 #include <FixedPoint.h>
+#include <ControlRate.h>
 
 #include <tables/sine_u16x1024.h>
 #include <tables/exp1000_u16x1024.h>
@@ -51,18 +52,28 @@ ADCTimer0 adc(2); // ADC (prameter inputs)
 
 /*
  * Sine wave table oscillator
- * - Wavetable16 --> 16-bit phase/frequency resolution
+ * - Wavetable32 --> 32-bit phase/frequency resolution, so the slowest rates
+ *   don't snap between 0.15Hz steps as with Wavetable16
  * - sine_u16x1024 --> 16-bit amplitude resolution, 10-bit length
  * - 6 --> shift 16-bit phasor by 6 bits to read from table
  */
-Wavetable16 lfo(sine_u16x1024, 6);
+Wavetable32 lfo(sine_u16x1024, 6);
 
 /* 
  *  Exponential frequency lookup table [0.2, 200] Hz
  *  - exp1000_u16x1024 --> Factor of 1000 sweep, 16-bit table, 10 bit length 
- *  - 200.0f/fs * 0xFFFF --> max freq 200Hz (normalized to 16-bit resolution)
+ *  - FREQ_SCALE --> max freq 200Hz, scaling the full 16-bit table value to a
+ *    16.16 frequency
  */
-PgmTable16 freq_table(exp1000_u16x1024, 200.0f/fs * 0xFFFF);
+PgmTable16 freq_table(exp1000_u16x1024);
+const uint16_t FREQ_SCALE = 200.0f/fs * 0x10000;
+
+/*
+ * Amplitude smoother
+ * - One-pole slew with time constant 0x10000/0x0200 = 128 samples (~13ms),
+ *   removing zipper noise from ADC steps. No work once settled.
+ */
+Smoother16 amp(0, Smoother16::SmoothOnePole, 0x0200);
 
 /*
  * Setup
@@ -114,11 +125,12 @@ ISR(ADC_vect) {
   adc.update();
 
   // Set the LFO rate from the lookup table
-  lfo.freq = freq_table.lookup_scale(adc.results[0]);
+  lfo.freq = (uint32_t)freq_table.lookup(adc.results[0]) * FREQ_SCALE;
 
-  // Render and scale the LFO
+  // Render and scale the LFO by the smoothed amplitude
+  amp.set(adc.results[1] << 6);
   sample = lfo.render();                        
-  sample = qmul16(sample, adc.results[1] << 6);  
+  sample = qmul16(sample, amp.render());  
 
   // Right-shift by 6 bits for 10-bit output
   timer1.pwm_write_a(sample >> 6);   
@@ -18,6 +18,7 @@
 #include <Envelope.h>
 #include <PgmTable.h>
 #include <FixedPoint.h>
+#include <ControlRate.h>
 
 #include <tables/exp100_u16x1024.h>
 
@@ -63,6 +64,11 @@ ASR16 asr;
  */
 PgmTable16 rate_table(exp100_u16x1024, 25.0f / fs * 0xFFFF);
 
+/*
+ * Control rate for envelope time lookups (every 32 samples, ~300Hz)
+ */
+ControlRate<32> ctl;
+
 // Hold the state of the envelope gate pin to detect changes
 bool state_gate = 0;
 
@@ -119,9 +125,11 @@ ISR(ADC_vect) {
   // Update ADC conversions
   adc.update();
 
-  // Set envelope times from the lookup table
-  asr.atk_rate = rate_table.lookup_scale(1023 - adc.results[0]);
-  asr.rel_rate = rate_table.lookup_scale(1023 - adc.results[1]);
+  // Set envelope times from the lookup table at control rate
+  if (ctl.tick()) {
+    asr.atk_rate = rate_table.lookup_scale(1023 - adc.results[0]);
+    asr.rel_rate = rate_table.lookup_scale(1023 - adc.results[1]);
+  }
   
   // Gate on rising edge on pin D4
   gate_in = PIND & (1 << PD4);  
@@ -18,9 +18,10 @@
 #include <IIR.h>
 #include <PgmTable.h>
 #include <FixedPoint.h>
+#include <ControlRate.h>
 
-#include <tables/exp1000_u16x1024.h>
-#include <tables/exp10000_u16x1024.h>
+#include <tables/exp1000_u16x128.h>
+#include <tables/exp10000_u16x128.h>
 
 /* 
  * Timer 0 determines sample rate (fs = 16e6/8/200 = 10kHz)
@@ -58,10 +59,11 @@ Phasor16 lfo;
 
 /* 
 *  Exponential frequency lookup table [0.2, 200] Hz
-*  - exp1000_u16x1024 --> Factor of 1000 sweep, 16-bit table, 10 bit length 
+*  - exp1000_u16x128 --> Factor of 1000 sweep, 16-bit table, 128 entries,
+*    interpolated (3.5KB less flash than two 1024 entry tables)
 *  - 200.0f/fs * 0xFFFF --> max freq 200Hz (normalized to 16-bit resolution)
 */
-PgmTable16 freq_table(exp1000_u16x1024, 200.0f / fs * 0xFFFF);
+PgmTable16 freq_table(exp1000_u16x128, 200.0f / fs * 0xFFFF, 128);
 
 /*
  * One pole low pass filter
@@ -71,10 +73,20 @@ OnePole16 lpf;
 /*
  * Exponential frequency lookup table [0.2, 2000] Hz
  * - The UQ16 frequency is a decent approximation for the filter coefficient
- * - exp10000_u16x1024 --> Factor of 10000 sweep, unsigned 16-bit table, 10 bit length
+ * - exp10000_u16x128 --> Factor of 10000 sweep, unsigned 16-bit table, 128 entries
  *  - 2000.0f/fs * 0xFFFF --> max freq 2000Hz (normalized to 16-bit resolution)
  */
-PgmTable16 coeff_table(exp10000_u16x1024, 2000.0f/fs * 0xFFFF);
+PgmTable16 coeff_table(exp10000_u16x128, 2000.0f/fs * 0xFFFF, 128);
+
+/*
+ * Control rate parameter updates
+ * - Table lookups run every 32 samples (~300Hz), in update_params()
+ * - Ramps interpolate the frequency and coefficient in between
+ */
+void update_params();
+ControlRate<32> ctl(update_params);
+Ramp16<32> freq_ramp;
+Ramp16<32> coeff_ramp;
 
 /*
  * Setup
@@ -104,6 +116,16 @@ void loop() {
   ; // Do nothing
 }
 
+/*
+ * Look up new parameter targets from the ADC results
+ * - 10-bit results are widened to UQ16 indices, 1023 --> 0xFFFF
+ */
+void update_params() {
+  uint16_t f = adc.results[0], c = adc.results[1];
+  freq_ramp.set(freq_table.lookup_scale_interp(f << 6 | f >> 4));
+  coeff_ramp.set(coeff_table.lookup_scale_interp(c << 6 | c >> 4));
+}
+
 /* 
  * Note: this ISR must be included for timer 0 to trigger the ADC 
  */
@@ -126,9 +148,10 @@ ISR(ADC_vect) {
   // Update ADC conversions
   adc.update();
 
-  // Set the LFO rate from the lookup table
-  lfo.freq = freq_table.lookup_scale(adc.results[0]);
-  lpf.coeff = coeff_table.lookup_scale(adc.results[1]);
+  // Update parameters at control rate, interpolate at sample rate
+  ctl.tick();
+  lfo.freq = freq_ramp.render();
+  lpf.coeff = coeff_ramp.render();
 
   // Render LFO, convert to square wave
   u = lfo.render();
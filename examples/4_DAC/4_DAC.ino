@@ -116,8 +116,8 @@ ISR(ADC_vect) {
   cosine = lfo.cosine;     
   
   // Scale                 
-  cosine = qmul16(cosine, adc.results[1] << 6);
-  sine = qmul16(sine, adc.results[1] << 6);  
+  cosine = qmul16(cosine, (uint16_t)(adc.results[1] << 6));
+  sine = qmul16(sine, (uint16_t)(adc.results[1] << 6));  
 
   // Write samples to DAC, right-shifted by 4 bits for 12-bit output
   dac.write_a(sine >> 4);
@@ -31,7 +31,7 @@ struct Quad16 : public Wavetable16 {
   uint16_t render() {
     /* Render a cosine from the sine table using the sine's phase, offset by (2^16)/4,
      * which corresponds to pi/2 or 90 degrees */
-    cosine = (uint16_t)pgm_read_ptr(&sine_u16x1024[0] + ((phasor + (1 << 14)) >> shift));
+    cosine = pgm_read_word(&sine_u16x1024[0] + ((phasor + (1 << 14)) >> shift));
     Wavetable16::render();    // Render a sine to the 'sample' variable
     return sample;
   }
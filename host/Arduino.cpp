@@ -0,0 +1,36 @@
+/*
+  Arduino.cpp
+
+  Host register storage for the Arduino.h shim.
+
+  Copyright (C) 2021 Jeff Gregorio
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Arduino.h"
+
+#define AVR_REG(name) volatile uint8_t name = 0;
+#include "avr_regs.h"
+#undef AVR_REG
+
+/*
+ * Static initializer for registers with a nonzero reset state on host
+ * - SPIF is left set so SPI busy-waits fall straight through
+ */
+static struct HostRegInit {
+  HostRegInit() {
+    SPSR = (1 << SPIF);
+  }
+} host_reg_init;
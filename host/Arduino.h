@@ -0,0 +1,203 @@
+/*
+  Arduino.h
+
+  Host (x86-64) stand-in for the Arduino core header. Lets LibAG headers and
+  example sketches compile natively for benchmarking and regression checks:
+    - I/O registers are plain volatile bytes (see avr_regs.h)
+    - Register bit positions follow the ATmega328P datasheet
+    - PROGMEM is ordinary memory; pgm_read_*() are plain loads
+    - cli()/sei() are no-ops, ISR(vect) defines a function named vect
+
+  Only ever on the include path of host builds (see CMakeLists.txt). Never
+  include it from library headers.
+
+  Copyright (C) 2021 Jeff Gregorio
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define LIBAG_HOST 1
+
+/*
+ * I/O registers
+ */
+#define AVR_REG(name) extern volatile uint8_t name;
+#include "avr_regs.h"
+#undef AVR_REG
+
+/*
+ * Register bits (ATmega328P)
+ */
+// ADCSRA
+#define ADEN    7
+#define ADSC    6
+#define ADATE   5
+#define ADIF    4
+#define ADIE    3
+#define ADPS2   2
+#define ADPS1   1
+#define ADPS0   0
+// ADCSRB
+#define ACME    6
+#define ADTS2   2
+#define ADTS1   1
+#define ADTS0   0
+// ADMUX
+#define REFS1   7
+#define REFS0   6
+#define ADLAR   5
+// EIMSK, EICRA
+#define INT1    1
+#define INT0    0
+#define ISC11   3
+#define ISC10   2
+#define ISC01   1
+#define ISC00   0
+// TCCR0A/B, TIMSK0
+#define COM0A1  7
+#define COM0A0  6
+#define COM0B1  5
+#define COM0B0  4
+#define WGM02   3
+#define WGM01   1
+#define WGM00   0
+#define OCIE0B  2
+#define OCIE0A  1
+#define TOIE0   0
+// TCCR1A/B, TIMSK1
+#define COM1A1  7
+#define COM1A0  6
+#define COM1B1  5
+#define COM1B0  4
+#define WGM13   4
+#define WGM12   3
+#define WGM11   1
+#define WGM10   0
+#define OCIE1B  2
+#define OCIE1A  1
+#define TOIE1   0
+// TCCR2A/B, TIMSK2
+#define COM2A1  7
+#define COM2A0  6
+#define COM2B1  5
+#define COM2B0  4
+#define WGM22   3
+#define WGM21   1
+#define WGM20   0
+#define OCIE2B  2
+#define OCIE2A  1
+#define TOIE2   0
+// SPCR, SPSR
+#define SPIE    7
+#define SPE     6
+#define DORD    5
+#define MSTR    4
+#define CPOL    3
+#define CPHA    2
+#define SPR1    1
+#define SPR0    0
+#define SPIF    7
+#define WCOL    6
+#define SPI2X   0
+// Port pins
+#define PB0 0
+#define PB1 1
+#define PB2 2
+#define PB3 3
+#define PB4 4
+#define PB5 5
+#define PB6 6
+#define PB7 7
+#define PC0 0
+#define PC1 1
+#define PC2 2
+#define PC3 3
+#define PC4 4
+#define PC5 5
+#define PC6 6
+#define PD0 0
+#define PD1 1
+#define PD2 2
+#define PD3 3
+#define PD4 4
+#define PD5 5
+#define PD6 6
+#define PD7 7
+#define PH6 6
+
+/*
+ * Interrupts
+ * - ISR(vect) defines an ordinary function. Vectors are declared weak so a
+ *   host driver can call whichever ones a sketch happens to define.
+ */
+#define ISR(vect) extern "C" void vect(void)
+extern "C" {
+  void ADC_vect(void) __attribute__((weak));
+  void INT0_vect(void) __attribute__((weak));
+  void TIMER0_COMPA_vect(void) __attribute__((weak));
+  void TIMER1_COMPA_vect(void) __attribute__((weak));
+  void TIMER2_COMPA_vect(void) __attribute__((weak));
+}
+inline void cli() { ; }
+inline void sei() { ; }
+
+/*
+ * Program memory
+ * - Pointers are 16 bits on AVR, so pgm_read_ptr() is a 16-bit read there.
+ *   The host version reads 16 bits too, rather than a full host pointer, so
+ *   code using it on uint16_t tables behaves (and stays in bounds) as on AVR.
+ *   Use pgm_read_word() for 16-bit data.
+ * - Far addresses are host pointers, so ProgmemFar tables read the same 
+ *   memory as ProgmemNear ones.
+ */
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define pgm_read_float(addr) (*(const float *)(addr))
+#define pgm_read_ptr(addr) ((void *)(uintptr_t)pgm_read_word(addr))
+#define pgm_read_byte_far(addr) pgm_read_byte(addr)
+#define pgm_read_word_far(addr) pgm_read_word(addr)
+#define pgm_read_dword_far(addr) pgm_read_dword(addr)
+#define pgm_get_far_address(var) ((uintptr_t)&(var))
+typedef uintptr_t uint_farptr_t;
+
+/*
+ * Arduino core utilities used by LibAG and the examples
+ * - min/max are templates rather than the core's macros, so host code can
+ *   still include standard C++ headers afterward.
+ */
+typedef bool boolean;
+typedef uint8_t byte;
+
+template <typename A, typename B>
+inline A min(A a, B b) { return a < b ? a : (A)b; }
+template <typename A, typename B>
+inline A max(A a, B b) { return a > b ? a : (A)b; }
+
+// Sketch entry points
+void setup();
+void loop();
+
+#endif
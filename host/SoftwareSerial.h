@@ -0,0 +1,36 @@
+/*
+  SoftwareSerial.h
+
+  Host stand-in for the Arduino SoftwareSerial library. Receives nothing.
+
+  Copyright (C) 2021 Jeff Gregorio
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef SOFTWARESERIAL_H
+#define SOFTWARESERIAL_H
+
+struct SoftwareSerial {
+
+  SoftwareSerial(uint8_t rx, uint8_t tx) {
+    ; // Do nothing
+  }
+
+  void begin(long baud) { ; }
+  int available() { return 0; }
+  int read() { return -1; }
+};
+
+#endif
@@ -0,0 +1,56 @@
+/*
+  avr_regs.h
+
+  X-macro list of the ATmega328P I/O registers touched by LibAG. Expanded
+  by Arduino.h (declarations) and Arduino.cpp (definitions) for host builds.
+  
+  Copyright (C) 2021 Jeff Gregorio
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/  
+
+// Status register
+AVR_REG(SREG)
+
+// GPIO
+AVR_REG(PINB)   AVR_REG(DDRB)   AVR_REG(PORTB)
+AVR_REG(PINC)   AVR_REG(DDRC)   AVR_REG(PORTC)
+AVR_REG(PIND)   AVR_REG(DDRD)   AVR_REG(PORTD)
+AVR_REG(DDRG)   AVR_REG(DDRH)   // ATmega2560 only, kept so Timer.h compiles
+
+// External interrupts
+AVR_REG(EIMSK)  AVR_REG(EICRA)
+
+// ADC
+AVR_REG(ADCSRA) AVR_REG(ADCSRB) AVR_REG(ADMUX)
+AVR_REG(ADCL)   AVR_REG(ADCH)   AVR_REG(DIDR0)
+
+// Timer 0
+AVR_REG(TCCR0A) AVR_REG(TCCR0B) AVR_REG(TCNT0)
+AVR_REG(OCR0A)  AVR_REG(OCR0B)  AVR_REG(TIMSK0)
+
+// Timer 1
+AVR_REG(TCCR1A) AVR_REG(TCCR1B) AVR_REG(TIMSK1)
+AVR_REG(TCNT1L) AVR_REG(TCNT1H)
+AVR_REG(OCR1AL) AVR_REG(OCR1AH)
+AVR_REG(OCR1BL) AVR_REG(OCR1BH)
+AVR_REG(OCR1CL) AVR_REG(OCR1CH)
+AVR_REG(ICR1L)  AVR_REG(ICR1H)
+
+// Timer 2
+AVR_REG(TCCR2A) AVR_REG(TCCR2B) AVR_REG(TCNT2)
+AVR_REG(OCR2A)  AVR_REG(OCR2B)  AVR_REG(TIMSK2)
+
+// SPI
+AVR_REG(SPCR)   AVR_REG(SPSR)   AVR_REG(SPDR)
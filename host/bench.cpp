@@ -0,0 +1,405 @@
+/*
+  bench.cpp
+
+  Host benchmark of LibAG per-sample hot paths. Prints nanoseconds per
+  sample for each object; compare runs before and after a change. Host
+  timings rank alternatives but don't translate directly to AVR cycles.
+
+  Usage: libag_bench [samples]
+
+  Copyright (C) 2021 Jeff Gregorio
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Arduino.h"
+
+#include <stdio.h>
+#include <chrono>
+
+#include "FixedPoint.h"
+#include "Oscillator.h"
+#include "PgmTable.h"
+#include "Envelope.h"
+#include "IIR.h"
+#include "Noise.h"
+#include "ControlRate.h"
+#include "FIR.h"
+#include "Dynamics.h"
+
+#include "tables/sine_u16x1024.h"
+#include "tables/sine_u16x256.h"
+#include "tables/sineqw_u16x256.h"
+#include "tables/saw_bl_u16x256.h"
+#include "tables/exp1000_u16x1024.h"
+#include "tables/exp1000_u16x128.h"
+#include "tables/biquad_lp_s16x128.h"
+#include "tables/fir_lp100_s16x31.h"
+#include "tables/halfband_s16x23.h"
+#include "tables/log2_u16x256.h"
+#include "tables/exp2_u16x256.h"
+
+static volatile uint32_t sink;  // Keeps results observable to the optimizer
+static long n_samples = 1000000;
+
+/*
+ * Time n_samples calls of fn(i), print ns/sample
+ */
+template <typename F>
+static void bench(const char *name, F fn) {
+  uint32_t acc = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (long i = 0; i < n_samples; i++)
+    acc += fn((uint16_t)i);
+  auto t1 = std::chrono::steady_clock::now();
+  sink = acc;
+  double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+  printf("%-28s %8.3f ns/sample\n", name, ns / n_samples);
+}
+
+/*
+ * Time n_samples samples rendered by fn(buf, n) in blocks of 32, print 
+ * ns/sample
+ */
+template <typename F>
+static void bench_block(const char *name, F fn) {
+  const uint8_t n = 32;
+  uint16_t buf[n] = {0};
+  uint32_t acc = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (long i = 0; i < n_samples; i += n) {
+    fn(buf, n);
+    acc += buf[i & (n - 1)];
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  sink = acc;
+  double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+  printf("%-28s %8.3f ns/sample\n", name, ns / n_samples);
+}
+
+/*
+ * SNR of a sine wavetable oscillator against an ideal sine at the same
+ * phase, over normalized frequencies 0.001-0.1, print dB
+ */
+template <typename Osc>
+static void snr_sine(const char *name, Osc &osc) {
+  const uint16_t freqs[] = {0x0042, 0x0100, 0x0400, 0x1000, 0x1999};
+  double sig = 0, err = 0;
+  for (uint8_t k = 0; k < sizeof(freqs) / sizeof(freqs[0]); k++) {
+    osc.phase = osc.phasor = 0;
+    osc.freq = freqs[k];
+    for (long i = 0; i < 0x10000; i++) {
+      double ideal = 32767.5 * sin(2 * M_PI * osc.phasor / 65536.0);
+      double y = osc.render() - 32767.5;
+      sig += ideal * ideal;
+      err += (y - ideal) * (y - ideal);
+    }
+  }
+  printf("%-28s %8.1f dB SNR\n", name, 10 * log10(sig / err));
+}
+
+int main(int argc, char **argv) {
+
+  if (argc > 1)
+    n_samples = atol(argv[1]);
+
+  // Fixed point
+  bench("qmul16 (u, u)", [](uint16_t i) { return (uint32_t)qmul16((uint16_t)i, (uint16_t)0x9E37); });
+  bench("qmul16 (s, s)", [](uint16_t i) { return (uint32_t)qmul16((int16_t)i, (int16_t)0x4E37); });
+  bench("qmul16_pp (s, s)", [](uint16_t i) { return (uint32_t)qmul16_pp((int16_t)i, (int16_t)0x4E37); });
+  bench("Q16 * UQ16 (Fixed)", [](uint16_t i) { return (uint32_t)(Q16((int16_t)i) * UQ16(0x9E37)).raw; });
+  bench("qmul32 (s, s)", [](uint16_t i) { return (uint32_t)qmul32((int32_t)i << 12, (int32_t)0x4E3779B9); });
+  bench("qmul32_pp (s, s)", [](uint16_t i) { return (uint32_t)qmul32_pp((int32_t)i << 12, (int32_t)0x4E3779B9); });
+
+  // Tables
+  PgmTable16 freq_table(exp1000_u16x1024, 0x0539);
+  bench("PgmTable16::lookup_scale", [&](uint16_t i) { return (uint32_t)freq_table.lookup_scale(i & 0x3FF); });
+  MemTable16<ProgmemFar> freq_table_far(pgm_get_far_address(exp1000_u16x1024), 0x0539);
+  bench("MemTable16<ProgmemFar>::lookup_scale", [&](uint16_t i) { return (uint32_t)freq_table_far.lookup_scale(i & 0x3FF); });
+  PgmTable16 freq_table_128(exp1000_u16x128, 0x0539, 128);
+  bench("PgmTable16::lookup_scale_interp", [&](uint16_t i) { return (uint32_t)freq_table_128.lookup_scale_interp(i * 0x9E37); });
+
+  // Oscillators
+  Phasor16 saw;
+  saw.freq = 0x0123;
+  bench("Phasor16", [&](uint16_t i) { return (uint32_t)saw.render(); });
+  bench_block("Phasor16 (block)", [&](uint16_t *buf, uint8_t n) { saw.render_block(buf, n); });
+
+  Phasor32 saw32;
+  saw32.freq = 0x01234567;
+  bench("Phasor32", [&](uint16_t i) { return (uint32_t)saw32.render(); });
+  bench_block("Phasor32 (block)", [&](uint16_t *buf, uint8_t n) { saw32.render_block(buf, n); });
+
+  Phasor24 saw24;
+  saw24.freq = 0x012345;
+  bench("Phasor24", [&](uint16_t i) { return (uint32_t)saw24.render(); });
+  bench_block("Phasor24 (block)", [&](uint16_t *buf, uint8_t n) { saw24.render_block(buf, n); });
+
+  Wavetable16 sine(sine_u16x1024, 6);
+  sine.freq = 0x0123;
+  bench("Wavetable16", [&](uint16_t i) { return (uint32_t)sine.render(); });
+  bench_block("Wavetable16 (block)", [&](uint16_t *buf, uint8_t n) { sine.render_block(buf, n); });
+
+  static uint16_t sine_ram[1024];
+  for (uint16_t i = 0; i < 1024; i++)
+    sine_ram[i] = pgm_read_word(sine_u16x1024 + i);
+  MemWavetable16<MemRam> sine_r(sine_ram, 6);
+  sine_r.freq = 0x0123;
+  bench("MemWavetable16<MemRam>", [&](uint16_t i) { return (uint32_t)sine_r.render(); });
+
+  MemWavetable16<ProgmemFar> sine_far(pgm_get_far_address(sine_u16x1024), 6);
+  sine_far.freq = 0x0123;
+  bench("MemWavetable16<ProgmemFar>", [&](uint16_t i) { return (uint32_t)sine_far.render(); });
+
+  Wavetable32 sine32(sine_u16x1024, 6);
+  sine32.freq = 0x01234567;
+  bench("Wavetable32", [&](uint16_t i) { return (uint32_t)sine32.render(); });
+  bench_block("Wavetable32 (block)", [&](uint16_t *buf, uint8_t n) { sine32.render_block(buf, n); });
+
+  Wavetable24 sine24(sine_u16x1024, 6);
+  sine24.freq = 0x012345;
+  bench("Wavetable24", [&](uint16_t i) { return (uint32_t)sine24.render(); });
+  bench_block("Wavetable24 (block)", [&](uint16_t *buf, uint8_t n) { sine24.render_block(buf, n); });
+
+  Wavetable16_Interp sine_interp(sine_u16x1024, 6);
+  sine_interp.freq = 0x0123;
+  bench("Wavetable16_Interp", [&](uint16_t i) { return (uint32_t)sine_interp.render(); });
+  bench_block("Wavetable16_Interp (block)", [&](uint16_t *buf, uint8_t n) { sine_interp.render_block(buf, n); });
+
+  PMVoice16 pm(sine_u16x1024, 6);
+  pm.car.freq = 0x0123;
+  pm.mod.freq = 0x0246;
+  pm.car.index = 0x0A00;
+  pm.mod.index = 0x0400;
+  bench("PMVoice16", [&](uint16_t i) { return (uint32_t)pm.render(); });
+  bench_block("PMVoice16 (block)", [&](uint16_t *buf, uint8_t n) { pm.render_block(buf, n); });
+
+  Wavetable16 voices[8] = {
+    Wavetable16(sine_u16x1024, 6), Wavetable16(sine_u16x1024, 6),
+    Wavetable16(sine_u16x1024, 6), Wavetable16(sine_u16x1024, 6),
+    Wavetable16(sine_u16x1024, 6), Wavetable16(sine_u16x1024, 6),
+    Wavetable16(sine_u16x1024, 6), Wavetable16(sine_u16x1024, 6)
+  };
+  OscBank<8> bank(sine_u16x1024, 6);
+  for (uint8_t v = 0; v < 8; v++)
+    voices[v].freq = bank.freq[v] = 0x0123 * (v + 1);
+  bench("8x Wavetable16 (mixed)", [&](uint16_t i) {
+    uint32_t sum = 0;
+    for (uint8_t v = 0; v < 8; v++)
+      sum += voices[v].render();
+    return sum >> 3;
+  });
+  bench("OscBank<8>", [&](uint16_t i) { return (uint32_t)bank.render(); });
+  bench_block("OscBank<8> (block)", [&](uint16_t *buf, uint8_t n) { bank.render_block(buf, n); });
+
+  SineQW16 sine_qw(sineqw_u16x256, 6);
+  sine_qw.freq = 0x0123;
+  bench("SineQW16", [&](uint16_t i) { return (uint32_t)sine_qw.render(); });
+  bench_block("SineQW16 (block)", [&](uint16_t *buf, uint8_t n) { sine_qw.render_block(buf, n); });
+
+  SineQW16_Quad quad_qw(sineqw_u16x256, 6);
+  quad_qw.freq = 0x0123;
+  bench("SineQW16_Quad", [&](uint16_t i) { return (uint32_t)quad_qw.render() + quad_qw.cosine; });
+
+  RecursiveQuad16 quad_rec;
+  quad_rec.freq = 0x0123;
+  bench("RecursiveQuad16", [&](uint16_t i) { return (uint32_t)quad_rec.render() + quad_rec.cosine; });
+
+  WavetableSet16 saw_set(saw_bl_u16x256, 8);
+  saw_set.freq = 0x0123;
+  bench("WavetableSet16", [&](uint16_t i) { return (uint32_t)saw_set.render(); });
+
+  PolyBLEPSaw16 blep_saw;
+  blep_saw.freq = 0x0123;
+  bench("PolyBLEPSaw16", [&](uint16_t i) { return (uint32_t)blep_saw.render(); });
+
+  PolyBLEPPulse16 blep_pulse(0x4000);
+  blep_pulse.freq = 0x0123;
+  bench("PolyBLEPPulse16", [&](uint16_t i) { return (uint32_t)blep_pulse.render(); });
+
+  // Noise
+  NoiseLFSR16 lfsr16;
+  bench("NoiseLFSR16", [&](uint16_t i) { return (uint32_t)lfsr16.render(); });
+  NoiseLFSR32 lfsr32;
+  bench("NoiseLFSR32", [&](uint16_t i) { return (uint32_t)lfsr32.render(); });
+  NoiseXorshift16 xorshift16;
+  bench("NoiseXorshift16", [&](uint16_t i) { return (uint32_t)xorshift16.render(); });
+  bench_block("NoiseXorshift16 (block)", [&](uint16_t *buf, uint8_t n) { xorshift16.render_block(buf, n); });
+  NoisePink16 pink;
+  bench("NoisePink16", [&](uint16_t i) { return (uint32_t)pink.render(); });
+
+  // Wavetable quality
+  Wavetable16 sine_256(sine_u16x256, 8);
+  Wavetable16_Interp sine_interp_256(sine_u16x256, 8);
+  snr_sine("Wavetable16 x1024", sine);
+  snr_sine("Wavetable16 x256", sine_256);
+  snr_sine("SineQW16 x256 (x1024)", sine_qw);
+  snr_sine("Wavetable16_Interp x1024", sine_interp);
+  snr_sine("Wavetable16_Interp x256", sine_interp_256);
+
+  // Envelopes
+  ASR16 asr;
+  asr.atk_rate = 0x0010;
+  asr.rel_rate = 0x0010;
+  bench("ASR16", [&](uint16_t i) {
+    if ((i & 0x3FFF) == 0) asr.gate(!(i & 0x4000));
+    return (uint32_t)asr.render();
+  });
+  long asr_count = 0;
+  bench_block("ASR16 (block)", [&](uint16_t *buf, uint8_t n) {
+    if ((asr_count++ & 0x1FF) == 0) asr.gate(!(asr_count & 0x200));
+    asr.render_block(buf, n);
+  });
+
+  ADSR16 adsr;
+  adsr.atk_rate = 0x0010;
+  adsr.dec_rate = 0x0010;
+  adsr.rel_rate = 0x0010;
+  adsr.sustain = 0x8000;
+  bench("ADSR16 (linear)", [&](uint16_t i) {
+    if ((i & 0x3FFF) == 0) adsr.gate(!(i & 0x4000));
+    return (uint32_t)adsr.render();
+  });
+  adsr.atk_curve = adsr.dec_curve = adsr.rel_curve = ADSR16::EnvCurveExp;
+  bench("ADSR16 (exp)", [&](uint16_t i) {
+    if ((i & 0x3FFF) == 0) adsr.gate(!(i & 0x4000));
+    return (uint32_t)adsr.render();
+  });
+
+  static const uint16_t shape[] PROGMEM = {
+    0xFFFF, 0x0100, 0x4000, 0x0020, 0x8000, 0x0020, 0x0000, 0x0008
+  };
+  Breakpoint16 mseg(shape, 4, 1, 2);
+  bench("Breakpoint16", [&](uint16_t i) {
+    if ((i & 0x3FFF) == 0) mseg.gate(!(i & 0x4000));
+    return (uint32_t)mseg.render();
+  });
+
+  // Control rate: the parameter path alone, moving and held (knob is
+  // volatile, as an ADC result is, so held lookups aren't hoisted)
+  PgmTable16 coeff_table(exp1000_u16x1024, 0x0800);
+  static volatile uint16_t knob = 0x200;
+  bench("lookup_scale per sample", [&](uint16_t i) {
+    return (uint32_t)coeff_table.lookup_scale((i >> 4) & 0x3FF);
+  });
+  bench("lookup_scale, held", [&](uint16_t i) {
+    return (uint32_t)coeff_table.lookup_scale(knob);
+  });
+  ControlRate<32> ctl, ctl_held;
+  Ramp16<32> coeff_ramp, coeff_held;
+  bench("ControlRate+Ramp16", [&](uint16_t i) {
+    if (ctl.tick())
+      coeff_ramp.set(coeff_table.lookup_scale((i >> 4) & 0x3FF));
+    return (uint32_t)coeff_ramp.render();
+  });
+  bench("ControlRate+Ramp16, held", [&](uint16_t i) {
+    if (ctl_held.tick())
+      coeff_held.set(coeff_table.lookup_scale(knob));
+    return (uint32_t)coeff_held.render();
+  });
+  ControlRamp16<32> ctl_ramp, ctl_ramp_held;
+  bench("ControlRamp16", [&](uint16_t i) {
+    if (ctl_ramp.tick())
+      ctl_ramp.set(coeff_table.lookup_scale((i >> 4) & 0x3FF));
+    return (uint32_t)ctl_ramp.value;
+  });
+  bench("ControlRamp16, held", [&](uint16_t i) {
+    if (ctl_ramp_held.tick())
+      ctl_ramp_held.set(coeff_table.lookup_scale(knob));
+    return (uint32_t)ctl_ramp_held.value;
+  });
+
+  Smoother16 smooth_moving(0, Smoother16::SmoothOnePole, 0x0010);
+  bench("Smoother16 (slewing)", [&](uint16_t i) {
+    smooth_moving.set(i & 0x8000 ? 0xFFFF : 0);
+    return (uint32_t)smooth_moving.render();
+  });
+  Smoother16 smooth_settled(0, Smoother16::SmoothOnePole, 0x0100);
+  bench("Smoother16 (settled)", [&](uint16_t i) { return (uint32_t)smooth_settled.render(); });
+
+  // Filters
+  OnePole16 lp;
+  lp.coeff = 0x0800;
+  bench("OnePole16", [&](uint16_t i) { return (uint32_t)lp.process(i & 0x100 ? 0x7FFF : -0x8000); });
+  bench_block("OnePole16 (block)", [&](uint16_t *buf, uint8_t n) { lp.process_block((int16_t *)buf, n); });
+
+  OnePole16_LF lp_lf;
+  lp_lf.coeff = 0x0800;
+  bench("OnePole16_LF", [&](uint16_t i) { return (uint32_t)lp_lf.process(i & 0x100 ? 0x7FFF : -0x8000); });
+  bench_block("OnePole16_LF (block)", [&](uint16_t *buf, uint8_t n) { lp_lf.process_block((int16_t *)buf, n); });
+
+  TPTOnePole16 tpt;
+  tpt.coeff = 0x0800;
+  bench("TPTOnePole16", [&](uint16_t i) { return (uint32_t)tpt.process(i & 0x100 ? 0x3FFF : -0x4000); });
+  bench_block("TPTOnePole16 (block)", [&](uint16_t *buf, uint8_t n) { tpt.process_block((int16_t *)buf, n); });
+
+  TPTOnePole16_LF tpt_lf;
+  tpt_lf.coeff = 0x0800;
+  bench("TPTOnePole16_LF", [&](uint16_t i) { return (uint32_t)tpt_lf.process(i & 0x100 ? 0x3FFF : -0x4000); });
+  bench_block("TPTOnePole16_LF (block)", [&](uint16_t *buf, uint8_t n) { tpt_lf.process_block((int16_t *)buf, n); });
+
+  TPTSVF16 svf;
+  svf.coeff = 0x0800;
+  svf.damping = 0x2000;
+  bench("TPTSVF16", [&](uint16_t i) { return (uint32_t)svf.process(i & 0x100 ? 0x0FFF : -0x1000); });
+  bench_block("TPTSVF16 (block)", [&](uint16_t *buf, uint8_t n) { svf.process_block((int16_t *)buf, n); });
+
+  TPTSVF16_LF svf_lf;
+  svf_lf.coeff = 0x0800;
+  svf_lf.damping = 0x2000;
+  bench("TPTSVF16_LF", [&](uint16_t i) { return (uint32_t)svf_lf.process(i & 0x100 ? 0x0FFF : -0x1000); });
+  bench_block("TPTSVF16_LF (block)", [&](uint16_t *buf, uint8_t n) { svf_lf.process_block((int16_t *)buf, n); });
+
+  Ladder16 ladder;
+  ladder.coeff = 0x0800;
+  ladder.res = 0x7000;
+  bench("Ladder16", [&](uint16_t i) { return (uint32_t)ladder.process(i & 0x100 ? 0x0FFF : -0x1000); });
+  bench_block("Ladder16 (block)", [&](uint16_t *buf, uint8_t n) { ladder.process_block((int16_t *)buf, n); });
+
+  EnvFollower16 follower;
+  bench("EnvFollower16", [&](uint16_t i) { return (uint32_t)follower.process(i & 0x100 ? 0x3FFF : -0x4000); });
+
+  RMS16<8> rms;
+  bench("RMS16", [&](uint16_t i) {
+    rms.process(i & 0x100 ? 0x3FFF : -0x4000);
+    return rms.ms;
+  });
+  bench("RMS16 + rms() every 32", [&](uint16_t i) {
+    rms.process(i & 0x100 ? 0x3FFF : -0x4000);
+    return (uint32_t)((i & 31) ? 0 : rms.rms());
+  });
+
+  Biquad16 bq;
+  bq.load(biquad_lp_s16x128 + 5 * 64);
+  bench("Biquad16", [&](uint16_t i) { return (uint32_t)bq.process(i & 0x100 ? 0x3FFF : -0x4000); });
+  bench_block("Biquad16 (block)", [&](uint16_t *buf, uint8_t n) { bq.process_block((int16_t *)buf, n); });
+
+  FIR16<31> fir(fir_lp100_s16x31);
+  bench("FIR16<31>", [&](uint16_t i) { return (uint32_t)fir.process(i & 0x100 ? 0x3FFF : -0x4000); });
+
+  HalfBandDecim16<23> decim(halfband_s16x23);
+  bench("HalfBandDecim16<23> (input)", [&](uint16_t i) {
+    decim.process(i & 0x100 ? 0x3FFF : -0x4000);
+    return (uint32_t)decim.out;
+  });
+
+  Compressor16<32> comp(log2_u16x256, exp2_u16x256);
+  comp.threshold = comp_db(-12);
+  comp.slope = comp_ratio(4);
+  bench("Compressor16<32>", [&](uint16_t i) { return (uint32_t)comp.process(i & 0x100 ? 0x3FFF : -0x4000); });
+  comp.makeup = comp_db(9);
+  bench("Compressor16<32> (makeup)", [&](uint16_t i) { return (uint32_t)comp.process(i & 0x100 ? 0x3FFF : -0x4000); });
+
+  return 0;
+}
@@ -0,0 +1,57 @@
+/*
+  headers.cpp
+
+  Host compile check: every library header in a single translation unit.
+
+  Copyright (C) 2021 Jeff Gregorio
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Arduino.h"
+
+#include "Timer.h"
+#include "ADCAuto.h"
+#include "DACSPI.h"
+#include "SPIMaster.h"
+#include "MIDIDispatcher.h"
+#include "FixedPoint.h"
+#include "Oscillator.h"
+#include "PgmTable.h"
+#include "Envelope.h"
+#include "IIR.h"
+#include "BlockBuffer.h"
+#include "Noise.h"
+#include "ControlRate.h"
+#include "FIR.h"
+#include "Dynamics.h"
+
+#include "tables/sine_u16x1024.h"
+#include "tables/sine_u16x256.h"
+#include "tables/sineqw_u16x256.h"
+#include "tables/saw_bl_u16x256.h"
+#include "tables/square_bl_u16x256.h"
+#include "tables/triangle_bl_u16x256.h"
+#include "tables/exp100_u16x1024.h"
+#include "tables/exp1000_u16x1024.h"
+#include "tables/exp10000_u16x1024.h"
+#include "tables/exp1000_u16x128.h"
+#include "tables/exp10000_u16x128.h"
+#include "tables/coeff_svf_u16x1024.h"
+#include "tables/damping_u16x1024.h"
+#include "tables/biquad_lp_s16x128.h"
+#include "tables/fir_lp100_s16x31.h"
+#include "tables/halfband_s16x23.h"
+#include "tables/log2_u16x256.h"
+#include "tables/exp2_u16x256.h"
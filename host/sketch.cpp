@@ -0,0 +1,40 @@
+/*
+  sketch.cpp
+
+  Host driver for an example sketch, selected at compile time with
+  -DSKETCH_INO="path/to/sketch.ino". Runs setup(), then a number of sample
+  periods (argv[1], default 10000), each calling loop() followed by any
+  timer, external interrupt, and ADC ISRs the sketch defines.
+
+  Copyright (C) 2021 Jeff Gregorio
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Arduino.h"
+#include SKETCH_INO
+
+int main(int argc, char **argv) {
+  long n = argc > 1 ? atol(argv[1]) : 10000;
+  setup();
+  for (long i = 0; i < n; i++) {
+    loop();
+    if (TIMER0_COMPA_vect) TIMER0_COMPA_vect();
+    if (TIMER1_COMPA_vect) TIMER1_COMPA_vect();
+    if (TIMER2_COMPA_vect) TIMER2_COMPA_vect();
+    if (INT0_vect) INT0_vect();
+    if (ADC_vect) ADC_vect();
+  }
+  return 0;
+}
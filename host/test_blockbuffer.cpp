@@ -0,0 +1,136 @@
+/*
+  test_blockbuffer.cpp
+
+  Host test: DoubleBuffer16 hand-off between the main loop and the ISR.
+  Drives next() and refill()/done() through steady refills, missed refills,
+  and a refill finished only after the ISR swapped onto it, checking the
+  halves refill() returns, the samples played, and the underrun count.
+
+  Copyright (C) 2021 Jeff Gregorio
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Arduino.h"
+
+#include <stdio.h>
+
+#include "BlockBuffer.h"
+
+static const uint8_t N = 4;
+typedef DoubleBuffer16<N> Buffer;
+
+static long failures = 0;
+
+static void check(bool ok, const char *what) {
+  if (!ok) {
+    printf("FAIL %s\n", what);
+    failures++;
+  }
+}
+
+/*
+ * Refill the next half with value v, checking refill() offers half h
+ */
+static void refill(Buffer &b, uint8_t h, uint16_t v, const char *what) {
+  uint16_t *block = b.refill();
+  check(block == b.buf[h], what);
+  if (block) {
+    for (uint8_t i = 0; i < N; i++)
+      block[i] = v;
+    b.done();
+  }
+}
+
+/*
+ * Play one block from the ISR, checking every sample is v
+ */
+static void play(Buffer &b, uint16_t v, const char *what) {
+  bool ok = true;
+  for (uint8_t i = 0; i < N; i++)
+    ok &= b.next() == v;
+  check(ok, what);
+}
+
+int main() {
+
+  // Steady: refilled every sample, played back in order with no underruns
+  {
+    Buffer b;
+    uint16_t v = 1, expect = 0;
+    bool ok = true;
+    for (int t = 0; t < 64 * N; t++) {
+      uint16_t *block = b.refill();
+      if (block) {
+        for (uint8_t i = 0; i < N; i++)
+          block[i] = v;
+        v++;
+        b.done();
+      }
+      uint16_t s = b.next();
+      if (t % N == 0 && t)
+        expect++;
+      ok &= s == expect;
+    }
+    check(ok, "steady: blocks played in order");
+    check(b.underruns == 0, "steady: no underruns");
+  }
+
+  // Missed refills: each stale replay is counted, and refill() hands out
+  // the half just played
+  {
+    Buffer b;
+    refill(b, 1, 1, "missed: first refill is half 1");
+    play(b, 0, "missed: half 0 plays silence first");
+    refill(b, 0, 2, "missed: half 0 offered once played");
+    play(b, 1, "missed: block 1 plays");
+    check(b.underruns == 0, "missed: no underruns while refilled");
+    play(b, 2, "missed: block 2 plays");          // Half 1 not refilled
+    check(b.underruns == 1, "missed: first miss counted");
+    check(b.refill() == b.buf[0], "missed: half 0 offered after a miss");
+    play(b, 1, "missed: stale block 1 replays");  // Half 0 not refilled
+    check(b.underruns == 2, "missed: second miss counted");
+    refill(b, 1, 3, "missed: half 1 offered after a second miss");
+    play(b, 2, "missed: stale block 2 replays");
+    check(b.underruns == 2, "missed: refilled half not counted");
+    refill(b, 0, 4, "missed: half 0 offered after recovery");
+    play(b, 3, "missed: block 3 plays");
+    refill(b, 1, 5, "missed: half 1 offered after recovery");
+    play(b, 4, "missed: block 4 plays");
+    check(b.underruns == 2, "missed: no underruns after recovery");
+  }
+
+  // Late refill: the ISR swaps onto the half being rendered
+  {
+    Buffer b;
+    uint16_t *block = b.refill();
+    check(block == b.buf[1], "late: first refill is half 1");
+    play(b, 0, "late: half 0 plays silence");     // Swaps onto half 1
+    check(b.underruns == 1, "late: late refill counted");
+    for (uint8_t i = 0; i < N; i++)
+      block[i] = 1;
+    b.done();
+    refill(b, 0, 2, "late: half 0 offered next");
+    play(b, 1, "late: late block plays");
+    refill(b, 1, 3, "late: half 1 offered once played");
+    play(b, 2, "late: block 2 plays");
+    check(b.underruns == 1, "late: no further underruns");
+  }
+
+  if (failures) {
+    printf("%ld failures\n", failures);
+    return 1;
+  }
+  return 0;
+}
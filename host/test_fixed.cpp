@@ -0,0 +1,81 @@
+/*
+  test_fixed.cpp
+
+  Host test: Fixed<> format conversions, rounded and saturating 
+  multiplication, and saturating addition and subtraction, against values
+  worked out by hand, including mixed signed/unsigned operands.
+
+  Copyright (C) 2021 Jeff Gregorio
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Arduino.h"
+
+#include <stdio.h>
+
+#include "FixedPoint.h"
+
+static long failures = 0;
+
+/*
+ * Compare a raw result against its expected value
+ */
+static void check(const char *name, int64_t got, int64_t expected) {
+  if (got != expected) {
+    printf("FAIL %s: got %lld, expected %lld\n", name, (long long)got, 
+      (long long)expected);
+    failures++;
+  }
+}
+
+int main() {
+
+  // Rounded multiplication, same format and mixed
+  check("UQ16 * UQ16", (UQ16(0xC000) * UQ16(0x8000)).raw, 0x6000);
+  check("Q16 * UQ16", (Q16(0x4000) * UQ16(0xC000)).raw, 0x3000);
+  check("Q16 * Q16", (Q16(-0x4000) * Q16(0x4000)).raw, -0x2000);
+  check("Q16 * UQ16 rounding", (Q16(1) * UQ16(0x8000)).raw, 1);
+  check("UQ8 * Q16", (UQ8(0x80) * Q16(0x4000)).raw, 0x40);
+
+  // Saturating multiplication: overflow, and negative into unsigned
+  check("Q16 mulsat -1 x -1", Q16(-0x8000).mulsat(Q16(-0x8000)).raw, 0x7FFF);
+  check("UQ16 mulsat Q16 < 0", UQ16(0x8000).mulsat(Q16(-0x4000)).raw, 0);
+  check("UQ8 mulsat Q8 < 0", UQ8(0xFF).mulsat(Q8(-1)).raw, 0);
+  check("UQ16 mulsat Q16 > 0", UQ16(0x8000).mulsat(Q16(0x4000)).raw, 0x4000);
+  check("Q16 mulsat UQ16", Q16(-0x8000).mulsat(UQ16(0xFFFF)).raw, -0x7FFF);
+  check("UQ8.8 mulsat UQ8.8", (Fixed<8, 8, false>(0x1000).mulsat(
+    Fixed<8, 8, false>(0x1000))).raw, 0xFFFF);
+
+  // Saturating addition and subtraction
+  check("UQ16 addsat", UQ16(0xF000).addsat(UQ16(0x2000)).raw, 0xFFFF);
+  check("UQ16 subsat", UQ16(0x1000).subsat(UQ16(0x2000)).raw, 0);
+  check("Q16 addsat +", Q16(0x7000).addsat(Q16(0x2000)).raw, 0x7FFF);
+  check("Q16 addsat -", Q16(-0x7000).addsat(Q16(-0x2000)).raw, -0x8000);
+  check("Q16 subsat -", Q16(-0x7000).subsat(Q16(0x2000)).raw, -0x8000);
+  check("Q16 subsat +", Q16(0x7000).subsat(Q16(-0x2000)).raw, 0x7FFF);
+  check("Q16 addsat mixed", Q16(0x7000).addsat(Q16(-0x2000)).raw, 0x5000);
+
+  // Format conversion
+  check("Q16 as Q32", Q16(-0x4000).as<Q32>().raw, -0x40000000LL);
+  check("Q32 as Q16", Q32(0x40000000).as<Q16>().raw, 0x4000);
+  check("UQ16 as UQ8", UQ16(0xABCD).as<UQ8>().raw, 0xAB);
+  check("from_float", Q16::from_float(-0.25).raw, -0x2000);
+
+  if (failures) {
+    printf("%ld failures\n", failures);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,157 @@
+/*
+  test_noise.cpp
+
+  Host test: measured spectra of the Noise.h generators. White sources must
+  be flat, and NoisePink16 must fall at 3dB/octave, to within 1dB per
+  octave band. Also checks the 16-bit generators' periods. Band levels are
+  printed for reference.
+
+  Copyright (C) 2021 Jeff Gregorio
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Arduino.h"
+
+#include <stdio.h>
+#include <complex>
+
+#include "Noise.h"
+
+static const int N_FFT = 1024;         // Bin width fs/1024
+static const int N_SEGMENTS = 512;
+static const int N_BANDS = 8;          // Octaves [fs/512, fs/256) ... [fs/4, fs/2)
+
+static long failures = 0;
+
+/*
+ * In-place radix-2 FFT
+ */
+static void fft(std::complex<double> *x, int n) {
+  for (int i = 1, j = 0; i < n; i++) {
+    int bit = n >> 1;
+    for (; j & bit; bit >>= 1)
+      j ^= bit;
+    j ^= bit;
+    if (i < j)
+      std::swap(x[i], x[j]);
+  }
+  for (int len = 2; len <= n; len <<= 1) {
+    std::complex<double> w = std::polar(1.0, -2 * M_PI / len);
+    for (int i = 0; i < n; i += len) {
+      std::complex<double> wk = 1;
+      for (int k = 0; k < len / 2; k++) {
+        std::complex<double> a = x[i + k], b = x[i + k + len / 2] * wk;
+        x[i + k] = a + b;
+        x[i + k + len / 2] = a - b;
+        wk *= w;
+      }
+    }
+  }
+}
+
+/*
+ * Average power spectral density per octave band in dB (Welch, Hann window)
+ */
+template <typename Gen>
+static void octave_bands(Gen &gen, double *bands) {
+  static double psd[N_FFT / 2];
+  static std::complex<double> x[N_FFT];
+  for (int k = 0; k < N_FFT / 2; k++)
+    psd[k] = 0;
+  for (int s = 0; s < N_SEGMENTS; s++) {
+    for (int i = 0; i < N_FFT; i++) {
+      double w = 0.5 - 0.5 * cos(2 * M_PI * i / N_FFT);
+      x[i] = w * ((double)gen.render() - 32768.0);
+    }
+    fft(x, N_FFT);
+    for (int k = 0; k < N_FFT / 2; k++)
+      psd[k] += norm(x[k]);
+  }
+  for (int b = 0; b < N_BANDS; b++) {
+    double p = 0;
+    int k0 = 2 << b, k1 = 4 << b;
+    for (int k = k0; k < k1; k++)
+      p += psd[k];
+    bands[b] = 10 * log10(p / (k1 - k0) / N_SEGMENTS);
+  }
+}
+
+/*
+ * Check band levels against a slope (dB/octave), relative to their mean
+ */
+template <typename Gen>
+static void check_slope(const char *name, Gen &gen, double slope, double tol) {
+  double bands[N_BANDS], mean = 0;
+  octave_bands(gen, bands);
+  for (int b = 0; b < N_BANDS; b++)
+    mean += (bands[b] - slope * b) / N_BANDS;
+  printf("%-16s", name);
+  bool ok = true;
+  for (int b = 0; b < N_BANDS; b++) {
+    double dev = bands[b] - slope * b - mean;
+    printf(" %6.1f", bands[b] - bands[0]);
+    if (fabs(dev) > tol)
+      ok = false;
+  }
+  printf(ok ? "\n" : "  FAIL\n");
+  if (!ok)
+    failures++;
+}
+
+/*
+ * Check that a generator's state first repeats after period steps
+ */
+template <typename Gen>
+static void check_period(const char *name, Gen &gen, long period) {
+  uint16_t seed = gen.state;
+  long n = 0;
+  do {
+    gen.render();
+    n++;
+  } while (gen.state != seed && n <= period);
+  if (n != period) {
+    printf("FAIL %s: period %ld, expected %ld\n", name, n, period);
+    failures++;
+  }
+}
+
+int main() {
+
+  NoiseLFSR16 lfsr16;
+  NoiseLFSR32 lfsr32;
+  NoiseXorshift16 xorshift16;
+  NoisePink16 pink;
+
+  printf("%-16s", "dB re. lowest");
+  for (int b = 0; b < N_BANDS; b++) {
+    char label[8];
+    snprintf(label, sizeof(label), "fs/%d", 512 >> b);
+    printf(" %6s", label);
+  }
+  printf("\n");
+  check_slope("NoiseLFSR16", lfsr16, 0, 1);
+  check_slope("NoiseLFSR32", lfsr32, 0, 1);
+  check_slope("NoiseXorshift16", xorshift16, 0, 1);
+  check_slope("NoisePink16", pink, -3.01, 1);
+
+  check_period("NoiseLFSR16", lfsr16, 0xFFFF);
+  check_period("NoiseXorshift16", xorshift16, 0xFFFF);
+
+  if (failures) {
+    printf("%ld failures\n", failures);
+    return 1;
+  }
+  return 0;
+}
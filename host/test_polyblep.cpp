@@ -0,0 +1,137 @@
+/*
+  test_polyblep.cpp
+
+  Host test: measured aliasing of the PolyBLEP oscillators. Each oscillator
+  runs at an odd freq for 2^16 samples, an exact whole number of periods, so
+  every harmonic below fs/2 lands in its own FFT bin and everything else is
+  aliasing. PolyBLEPSaw16 and PolyBLEPSquare16 must improve the harmonic to
+  alias power ratio of the naive waveforms by at least 10dB at each
+  frequency. Ratios are printed for reference.
+
+  Copyright (C) 2021 Jeff Gregorio
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Arduino.h"
+
+#include <stdio.h>
+#include <complex>
+
+#include "Oscillator.h"
+
+static const int N_FFT = 0x10000;      // One full phase accumulator cycle
+static const int16_t freqs[] = {525, 1967, 4095, 8191};   // ~0.008-0.125 fs
+static const int N_FREQS = sizeof(freqs) / sizeof(freqs[0]);
+
+static long failures = 0;
+
+/*
+ * Naive square wave, thresholded Phasor16
+ */
+struct NaiveSquare16 : public Phasor16 {
+  uint16_t render() {
+    return Phasor16::render() < 0x8000 ? 0xFFFF : 0;
+  }
+};
+
+/*
+ * In-place radix-2 FFT
+ */
+static void fft(std::complex<double> *x, int n) {
+  for (int i = 1, j = 0; i < n; i++) {
+    int bit = n >> 1;
+    for (; j & bit; bit >>= 1)
+      j ^= bit;
+    j ^= bit;
+    if (i < j)
+      std::swap(x[i], x[j]);
+  }
+  for (int len = 2; len <= n; len <<= 1) {
+    std::complex<double> w = std::polar(1.0, -2 * M_PI / len);
+    for (int i = 0; i < n; i += len) {
+      std::complex<double> wk = 1;
+      for (int k = 0; k < len / 2; k++) {
+        std::complex<double> a = x[i + k], b = x[i + k + len / 2] * wk;
+        x[i + k] = a + b;
+        x[i + k + len / 2] = a - b;
+        wk *= w;
+      }
+    }
+  }
+}
+
+/*
+ * Harmonic to alias power ratio in dB at a given freq
+ */
+template <typename Gen>
+static double harmonic_to_alias(int16_t freq) {
+  static std::complex<double> x[N_FFT];
+  Gen gen;
+  gen.freq = freq;
+  for (int i = 0; i < N_FFT; i++)
+    x[i] = (double)gen.render() - 32768.0;
+  fft(x, N_FFT);
+  double harmonic = 0, alias = 0;
+  for (int k = 1; k < N_FFT / 2; k++) {
+    if (k % freq == 0)
+      harmonic += norm(x[k]);
+    else
+      alias += norm(x[k]);
+  }
+  return 10 * log10(harmonic / alias);
+}
+
+/*
+ * Print and check a band-limited oscillator against its naive version
+ */
+template <typename Naive, typename BL>
+static void check(const char *naive_name, const char *bl_name, double min_gain) {
+  double naive[N_FREQS], bl[N_FREQS];
+  bool ok = true;
+  for (int f = 0; f < N_FREQS; f++) {
+    naive[f] = harmonic_to_alias<Naive>(freqs[f]);
+    bl[f] = harmonic_to_alias<BL>(freqs[f]);
+    if (bl[f] - naive[f] < min_gain)
+      ok = false;
+  }
+  printf("%-18s", naive_name);
+  for (int f = 0; f < N_FREQS; f++)
+    printf(" %6.1f", naive[f]);
+  printf("\n%-18s", bl_name);
+  for (int f = 0; f < N_FREQS; f++)
+    printf(" %6.1f", bl[f]);
+  printf(ok ? "\n" : "  FAIL\n");
+  if (!ok)
+    failures++;
+}
+
+int main() {
+
+  printf("%-18s", "dB harm./alias");
+  for (int f = 0; f < N_FREQS; f++) {
+    char label[8];
+    snprintf(label, sizeof(label), "%.3f", freqs[f] / 65536.0);
+    printf(" %6s", label);
+  }
+  printf("\n");
+  check<Phasor16, PolyBLEPSaw16>("Phasor16 (saw)", "PolyBLEPSaw16", 10);
+  check<NaiveSquare16, PolyBLEPSquare16>("Naive square", "PolyBLEPSquare16", 10);
+
+  if (failures) {
+    printf("%ld failures\n", failures);
+    return 1;
+  }
+  return 0;
+}
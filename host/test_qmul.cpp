@@ -0,0 +1,105 @@
+/*
+  test_qmul.cpp
+
+  Host test: the partial product Q multiplication kernels used on AVR 
+  (qmul16_pp, qmul32_pp) must be bit-exact with the portable wide-multiply
+  references (qmul16_ref, qmul32_ref). 16-bit kernels are checked 
+  exhaustively, 32-bit kernels on edge cases and random operands.
+
+  Usage: test_qmul [random 32-bit pairs]
+
+  Copyright (C) 2021 Jeff Gregorio
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Arduino.h"
+
+#include <stdio.h>
+
+#include "FixedPoint.h"
+
+static long failures = 0;
+
+/*
+ * Report a mismatch (first few only)
+ */
+static void fail(const char *name, uint32_t a, uint32_t b, int64_t ref, int64_t pp) {
+  if (failures++ < 10)
+    printf("FAIL %s(0x%08x, 0x%08x): ref 0x%llx, pp 0x%llx\n", name, a, b, 
+      (unsigned long long)ref, (unsigned long long)pp);
+}
+
+/*
+ * xorshift32 operand generator
+ */
+static uint32_t rng = 0x2545F491;
+static uint32_t rand32() {
+  rng ^= rng << 13;
+  rng ^= rng >> 17;
+  rng ^= rng << 5;
+  return rng;
+}
+
+/*
+ * Compare all three 32-bit kernels for one operand pair
+ */
+static void check32(uint32_t a, uint32_t b) {
+  if (qmul32_pp(a, b) != qmul32_ref(a, b))
+    fail("qmul32 (u, u)", a, b, qmul32_ref(a, b), qmul32_pp(a, b));
+  if (qmul32_pp(a, (int32_t)b) != qmul32_ref(a, (int32_t)b))
+    fail("qmul32 (u, s)", a, b, qmul32_ref(a, (int32_t)b), qmul32_pp(a, (int32_t)b));
+  if (qmul32_pp((int32_t)a, (int32_t)b) != qmul32_ref((int32_t)a, (int32_t)b))
+    fail("qmul32 (s, s)", a, b, qmul32_ref((int32_t)a, (int32_t)b), qmul32_pp((int32_t)a, (int32_t)b));
+}
+
+int main(int argc, char **argv) {
+
+  long n_random = argc > 1 ? atol(argv[1]) : 10000000;
+
+  // 16-bit, exhaustive
+  for (uint32_t a = 0; a <= 0xFFFF; a++) {
+    for (uint32_t b = 0; b <= 0xFFFF; b++) {
+      if (qmul16_pp((uint16_t)a, (uint16_t)b) != qmul16_ref((uint16_t)a, (uint16_t)b))
+        fail("qmul16 (u, u)", a, b, qmul16_ref((uint16_t)a, (uint16_t)b), qmul16_pp((uint16_t)a, (uint16_t)b));
+      if (qmul16_pp((uint16_t)a, (int16_t)b) != qmul16_ref((uint16_t)a, (int16_t)b))
+        fail("qmul16 (u, s)", a, b, qmul16_ref((uint16_t)a, (int16_t)b), qmul16_pp((uint16_t)a, (int16_t)b));
+      if (qmul16_pp((int16_t)a, (int16_t)b) != qmul16_ref((int16_t)a, (int16_t)b))
+        fail("qmul16 (s, s)", a, b, qmul16_ref((int16_t)a, (int16_t)b), qmul16_pp((int16_t)a, (int16_t)b));
+    }
+  }
+
+  // 32-bit, edge cases: extremes and values near carry/rounding boundaries
+  const uint32_t edges[] = {
+    0x00000000, 0x00000001, 0x00000002, 0x00007FFF, 0x00008000, 0x0000FFFF, 
+    0x00010000, 0x00010001, 0x7FFFFFFF, 0x80000000, 0x80000001, 0x8000FFFF,
+    0xFFFF0000, 0xFFFF8000, 0xFFFFFFFE, 0xFFFFFFFF, 0x55555555, 0xAAAAAAAA
+  };
+  const int n_edges = sizeof(edges) / sizeof(edges[0]);
+  for (int i = 0; i < n_edges; i++)
+    for (int j = 0; j < n_edges; j++)
+      check32(edges[i], edges[j]);
+
+  // 32-bit, random
+  for (long n = 0; n < n_random; n++)
+    check32(rand32(), rand32());
+
+  if (failures) {
+    printf("%ld failures\n", failures);
+    return 1;
+  }
+  printf("qmul16_pp: 3 x 2^32 pairs, qmul32_pp: 3 x %ld pairs, bit-exact\n", 
+    n_random + n_edges * n_edges);
+  return 0;
+}
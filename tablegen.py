@@ -67,7 +67,7 @@ def tab_scale(table, dtype):
 	for n in range(len(table)):
 		out.append(table[n] * ((1 << y_res) - 1))
 	if dtype[0] == 's':
-		for n in range(args.tablen):
+		for n in range(len(out)):
 			out[n] -= (1 << (y_res-1))
 	return out
 
@@ -78,6 +78,51 @@ def table_sine(length):
 		table.append(0.5 *  math.sin(2 * math.pi * n / length) + 0.5)
 	return table
 
+# Quarter-wave sine table: [0, pi/2] inclusive in length+1 entries
+# - Unsigned magnitude in [0, 2^15-1] (u16), to be added to or subtracted from
+#   the midpoint; see SineQW16 in Oscillator.h
+# - Equivalent in resolution to a full-period table of 4*length entries
+def table_sineqw(length):
+	table = []
+	for n in range(length + 1):
+		table.append(0.5 * math.sin(0.5 * math.pi * n / length) * 32767 / 32767.5)
+	return table
+
+# Band-limited wavetable set: one table per octave of normalized frequency
+# - Table k is used for frequencies with high byte bit length k, i.e. 
+#   [0, 2^8), [2^8, 2^9), ..., [2^14, 2^15) in 16-bit normalized units, see
+#   WavetableSet16 in Oscillator.h
+# - Each includes harmonics n with n * (upper bound) <= fs/2, limited to 
+#   length/2 - 1 to avoid aliasing within the table itself
+# - All tables share one normalization so amplitude is constant across octaves
+def table_blset(amps, length, n_tables=8):
+	tables = []
+	for k in range(n_tables):
+		f_max = 1 << (8 + k)
+		n_max = min(32768 // f_max, length // 2 - 1, len(amps))
+		table = []
+		for n in range(length):
+			x = 2 * math.pi * n / length
+			table.append(sum(amps[h] * math.sin((h + 1) * x) for h in range(n_max)))
+		tables.append(table)
+	peak = max(max(abs(v) for v in t) for t in tables)
+	out = []
+	for t in tables:
+		out += [0.5 * v / peak + 0.5 for v in t]
+	return out
+
+# Harmonic amplitudes (of sines, fundamental first) for classic waveforms
+def harmonics(wave, n):
+	amps = []
+	for h in range(1, n + 1):
+		if wave == 'saw':
+			amps.append(1.0 / h)
+		elif wave == 'square':
+			amps.append(1.0 / h if h % 2 else 0.0)
+		elif wave == 'triangle':
+			amps.append((-1.0) ** ((h - 1) // 2) / (h * h) if h % 2 else 0.0)
+	return amps
+
 # Exponential frequency table
 def table_exp(e0, e1, length):
 	table = []
@@ -125,6 +170,125 @@ def table_coeff_tpt(omega_n):
 		table[i] /= (1 + table[i])
 	return table
 
+# TPT state variable filter coefficient g = tan(pi * f), for f < 0.25
+# - See TPTSVF16 in IIR.h
+def table_coeff_svf(f_n):
+	table = []
+	for i in range(len(f_n)):
+		if f_n[i] >= 0.25:
+			raise ValueError('SVF coefficient requires f < 0.25')
+		table.append(math.tan(math.pi * f_n[i]))
+	return table
+
+# State variable filter damping R = 1/(2Q), Q exponential over [q0, q1]
+# with q0 >= 0.5
+def table_damping(q0, q1, length):
+	table = []
+	for q in table_exp(q0, q1, length):
+		table.append(0.5 / q)
+	return table
+
+# Base 2 logarithm of the mantissa, log2(1 + n/length) in [0, 1)
+# - Indexed by the bits below a normalized value's leading one, see 
+#   Compressor16 in Dynamics.h
+def table_log2(length):
+	table = []
+	for n in range(length):
+		table.append(math.log2(1 + n / length))
+	return table
+
+# Base 2 exponential of the fraction, 2^(n/length) - 1 in [0, 1)
+# - Indexed by the fractional bits of a log2 value, see Compressor16 in 
+#   Dynamics.h
+def table_exp2(length):
+	table = []
+	for n in range(length):
+		table.append(2 ** (n / length) - 1)
+	return table
+
+# Biquad coefficient sets, one per cutoff in omega_n
+# - Each set is {b0, b1, b2, a1, a2} in Q2.14 (RBJ cookbook responses, a0 
+#   normalized to 1), see Biquad16 in IIR.h
+# - LP and HP numerators are adjusted by at most 2 LSB for exactly unity
+#   gain at DC and fs/2, respectively, after quantization
+def table_biquad(ftype, omega_n, q):
+	one = 1 << 14
+	def quant(v):
+		return max(-0x8000, min(0x7FFF, int(round(v * one))))
+	table = []
+	for w in omega_n:
+		c = math.cos(w)
+		alpha = math.sin(w) / (2 * q)
+		a0 = 1 + alpha
+		a1 = quant(-2 * c / a0)
+		a2 = quant((1 - alpha) / a0)
+		if abs(a2) >= one or abs(a1) >= one + a2:
+			raise ValueError('Unstable quantized poles at omega %g' % w)
+		if ftype == 'lp':
+			d = one + a1 + a2
+			b0 = int(round(d / 4))
+			b = [b0, d - 2 * b0, b0]
+		elif ftype == 'hp':
+			d = one - a1 + a2
+			b0 = int(round(d / 4))
+			b = [b0, 2 * b0 - d, b0]
+		elif ftype == 'bp':
+			b0 = quant(alpha / a0)
+			b = [b0, 0, -b0]
+		elif ftype == 'notch':
+			b0 = quant(1 / a0)
+			b = [b0, a1, b0]
+		table += b + [a1, a2]
+	return table
+
+# Zeroth order modified Bessel function of the first kind (Kaiser window)
+def bessel_i0(x):
+	total, term, k = 1.0, 1.0, 1
+	while term > 1e-12 * total:
+		term *= (x / (2 * k)) ** 2
+		total += term
+		k += 1
+	return total
+
+# Kaiser windowed sinc low pass, n_taps taps with cutoff fc in (0, 0.5)
+def kaiser_sinc(n_taps, fc, beta):
+	h = []
+	mid = (n_taps - 1) / 2
+	for n in range(n_taps):
+		t = n - mid
+		sinc = 2 * fc if t == 0 else math.sin(2 * math.pi * fc * t) / (math.pi * t)
+		r = 2 * n / (n_taps - 1) - 1
+		h.append(sinc * bessel_i0(beta * math.sqrt(max(0.0, 1 - r * r))) / bessel_i0(beta))
+	return h
+
+# Symmetric FIR low pass: the first ceil(n_taps/2) taps in Q15, outermost 
+# first, see FIR16 in FIR.h
+# - The center tap absorbs rounding so DC gain is exactly 1
+def table_fir(n_taps, fc, beta):
+	h = kaiser_sinc(n_taps, fc, beta)
+	dc = sum(h)
+	half = [int(round(v / dc * 32768)) for v in h[:(n_taps + 1) // 2]]
+	total = 2 * sum(half) - (half[-1] if n_taps % 2 else 0)
+	if n_taps % 2:
+		half[-1] += 32768 - total
+	if max(abs(v) for v in half) > 0x7FFF:
+		raise ValueError('Tap out of Q15 range')
+	return half
+
+# Half-band FIR low pass (n_taps = 4m-1): the m nonzero taps on one side of
+# the 0.5 center tap in Q15, nearest the center first, see HalfBandDecim16
+# in FIR.h
+# - Taps are scaled to sum to 0.25 per side, so DC gain is exactly 1
+def table_halfband(n_taps, beta):
+	if (n_taps + 1) % 4:
+		raise ValueError('Half-band filters need 4m-1 taps')
+	h = kaiser_sinc(n_taps, 0.25, beta)
+	mid = (n_taps - 1) // 2
+	side = [h[mid + 2 * j + 1] for j in range((n_taps + 1) // 4)]
+	side = [int(round(v / (4 * sum(side)) * 32768)) for v in side]
+	side[0] += 8192 - sum(side)
+	return side
+
 # Main
 if __name__ == "__main__":
 
@@ -154,6 +318,25 @@ if __name__ == "__main__":
 	# Sine-specific options
 	sine_parser = subparser.add_parser('sine')
 
+	# Quarter-wave sine options
+	sineqw_parser = subparser.add_parser('sineqw')
+
+	# Band-limited wavetable set options
+	blset_parser = subparser.add_parser('blset')
+	blset_parser.add_argument('wave',
+		choices=['saw', 'square', 'triangle', 'custom'],
+		help='Waveform')
+	blset_parser.add_argument('-H', '--harmonics',
+		type=float,
+		nargs='+',
+		default=[1.0],
+		dest='harmonics',
+		help='Harmonic amplitudes for custom waveform, fundamental first')
+	blset_parser.add_argument('-N', '--name',
+		default='custom',
+		dest='name',
+		help='Name prefix for custom waveform')
+
 	# Exponential-specific options
 	exp_parser = subparser.add_parser('exp')
 	exp_parser.add_argument('ratio', 
@@ -172,7 +355,7 @@ if __name__ == "__main__":
 	# Coefficient-specific options
 	coeff_parser = subparser.add_parser('coeff')
 	coeff_parser.add_argument('method',
-		choices=['z', 'diff', 'trans', 'tpt'],
+		choices=['z', 'diff', 'trans', 'tpt', 'svf'],
 		default='z',
 		help='Coefficient calculation method')
 	coeff_parser.add_argument('fmin', 
@@ -182,6 +365,65 @@ if __name__ == "__main__":
 		type=float, 
 		help='Maximum frequency in (0, 0.5)')
 
+	# State variable filter damping options
+	damping_parser = subparser.add_parser('damping')
+	damping_parser.add_argument('qmin', 
+		type=float, 
+		help='Minimum resonance (Q), at least 0.5')
+	damping_parser.add_argument('qmax', 
+		type=float, 
+		help='Maximum resonance (Q)')
+
+	# Log2 and exp2 options
+	log2_parser = subparser.add_parser('log2')
+	exp2_parser = subparser.add_parser('exp2')
+
+	# FIR low pass options
+	fir_parser = subparser.add_parser('fir')
+	fir_parser.add_argument('taps', 
+		type=int, 
+		help='Number of taps')
+	fir_parser.add_argument('fc', 
+		type=float, 
+		help='Cutoff frequency in (0, 0.5)')
+	fir_parser.add_argument('-B', '--beta',
+		type=float,
+		default=8.0,
+		dest='beta',
+		help='Kaiser window beta (stopband vs transition width)')
+
+	# Half-band FIR options
+	halfband_parser = subparser.add_parser('halfband')
+	halfband_parser.add_argument('taps', 
+		type=int, 
+		help='Number of taps, 4m-1')
+	halfband_parser.add_argument('-B', '--beta',
+		type=float,
+		default=8.0,
+		dest='beta',
+		help='Kaiser window beta (stopband vs transition width)')
+
+	# Biquad coefficient set options
+	biquad_parser = subparser.add_parser('biquad')
+	biquad_parser.add_argument('type',
+		choices=['lp', 'hp', 'bp', 'notch'],
+		help='Filter response')
+	biquad_parser.add_argument('fmin', 
+		type=float, 
+		help='Minimum cutoff frequency in (0, 0.5)')
+	biquad_parser.add_argument('fmax', 
+		type=float, 
+		help='Maximum cutoff frequency in (0, 0.5)')
+	biquad_parser.add_argument('-Q', '--q',
+		type=float,
+		default=0.7071,
+		dest='q',
+		help='Resonance (Q), 0.7071 for Butterworth LP and HP')
+	biquad_parser.add_argument('-N', '--name',
+		default=None,
+		dest='name',
+		help='Name prefix, biquad_<type> by default')
+
 	# Parse
 	args = parser.parse_args()
 
@@ -189,8 +431,32 @@ if __name__ == "__main__":
 	prefix = args.func
 	if args.func == 'sine':
 		tab = table_sine(args.length)
+	elif args.func == 'blset':
+		if args.wave == 'custom':
+			amps = args.harmonics
+			prefix = args.name + '_bl'
+		else:
+			amps = harmonics(args.wave, args.length // 2)
+			prefix = args.wave + '_bl'
+		tab = table_blset(amps, args.length)
+	elif args.func == 'biquad':
+		args.dtype = 's16'	# Always Q2.14
+		omega_n = [2 * math.pi * f for f in table_exp(args.fmin, args.fmax, args.length)]
+		tab = table_biquad(args.type, omega_n, args.q)
+		prefix = args.name if args.name else 'biquad_' + args.type
+	elif args.func == 'fir':
+		args.dtype = 's16'	# Always Q15, named by tap count
+		args.length = args.taps
+		tab = table_fir(args.taps, args.fc, args.beta)
+		prefix = 'fir_lp%d' % int(round(args.fc * 1000))
+	elif args.func == 'halfband':
+		args.dtype = 's16'
+		args.length = args.taps
+		tab = table_halfband(args.taps, args.beta)
 	elif args.dtype[0] != 'u':
-		raise TypeError('Signed types only valid for sine table')
+		raise TypeError('Signed types only valid for sine and blset tables')
+	elif args.func == 'sineqw':
+		tab = table_sineqw(args.length)
 	elif args.func == 'exp':
 		tab = table_exp(1.0/args.ratio, 1.0, args.length)
 		prefix += str(int(round(args.ratio)))
@@ -210,9 +476,24 @@ if __name__ == "__main__":
 		elif args.method == 'tpt':
 			tab = table_coeff_tpt(table_exp(args.fmin, args.fmax, args.length))
 			prefix += '_tpt'
-
-	# Scale to integer range
-	tab_out = tab_scale(tab, args.dtype)
+		elif args.method == 'svf':
+			tab = table_coeff_svf(table_exp(args.fmin, args.fmax, args.length))
+			prefix += '_svf'
+	elif args.func == 'log2':
+		tab = table_log2(args.length)
+	elif args.func == 'exp2':
+		tab = table_exp2(args.length)
+	elif args.func == 'damping':
+		if args.qmin < 0.5:
+			raise ValueError('Damping requires Q >= 0.5')
+		tab = table_damping(args.qmin, args.qmax, args.length)
+
+	# Scale to integer range (biquad and FIR coefficients are already fixed 
+	# point)
+	if args.func in ['biquad', 'fir', 'halfband']:
+		tab_out = tab
+	else:
+		tab_out = tab_scale(tab, args.dtype)
 
 	# Print to file
 	name = '%s_%sx%d' % (prefix, args.dtype, args.length)
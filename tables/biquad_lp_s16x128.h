@@ -0,0 +1,85 @@
+#ifndef BIQUAD_LP_S16X128_H
+#define BIQUAD_LP_S16X128_H
+const int16_t biquad_lp_s16x128[] PROGMEM = {
+	 0x0004,  0x0008,  0x0004, -0x7d28,  0x3d38,  0x0004,  0x0008,  0x0004,
+	-0x7d13,  0x3d23,  0x0004,  0x0009,  0x0004, -0x7cfd,  0x3d0e,  0x0005,
+	 0x0009,  0x0005, -0x7ce6,  0x3cf9,  0x0005,  0x0009,  0x0005, -0x7ccf,
+	 0x3ce2,  0x0006,  0x000a,  0x0006, -0x7cb6,  0x3ccc,  0x0006,  0x000a,
+	 0x0006, -0x7c9e,  0x3cb4,  0x0006,  0x000c,  0x0006, -0x7c84,  0x3c9c,
+	 0x0006,  0x000d,  0x0006, -0x7c6a,  0x3c83,  0x0006,  0x000e,  0x0006,
+	-0x7c4f,  0x3c69,  0x0007,  0x000e,  0x0007, -0x7c33,  0x3c4f,  0x0008,
+	 0x000e,  0x0008, -0x7c16,  0x3c34,  0x0008,  0x000f,  0x0008, -0x7bf9,
+	 0x3c18,  0x0008,  0x0012,  0x0008, -0x7bda,  0x3bfc,  0x0009,  0x0011,
+	 0x0009, -0x7bbb,  0x3bde,  0x0009,  0x0013,  0x0009, -0x7b9b,  0x3bc0,
+	 0x000a,  0x0013,  0x000a, -0x7b7a,  0x3ba1,  0x000a,  0x0016,  0x000a,
+	-0x7b58,  0x3b82,  0x000b,  0x0016,  0x000b, -0x7b35,  0x3b61,  0x000c,
+	 0x0016,  0x000c, -0x7b11,  0x3b3f,  0x000c,  0x001a,  0x000c, -0x7aeb,
+	 0x3b1d,  0x000d,  0x001b,  0x000d, -0x7ac5,  0x3afa,  0x000e,  0x001b,
+	 0x000e, -0x7a9e,  0x3ad5,  0x000f,  0x001d,  0x000f, -0x7a75,  0x3ab0,
+	 0x0010,  0x001f,  0x0010, -0x7a4b,  0x3a8a,  0x0010,  0x0022,  0x0010,
+	-0x7a20,  0x3a62,  0x0012,  0x0022,  0x0012, -0x79f4,  0x3a3a,  0x0012,
+	 0x0026,  0x0012, -0x79c6,  0x3a10,  0x0014,  0x0026,  0x0014, -0x7998,
+	 0x39e6,  0x0015,  0x0029,  0x0015, -0x7967,  0x39ba,  0x0016,  0x002b,
+	 0x0016, -0x7936,  0x398d,  0x0017,  0x002f,  0x0017, -0x7902,  0x395f,
+	 0x0018,  0x0032,  0x0018, -0x78ce,  0x3930,  0x001a,  0x0034,  0x001a,
+	-0x7898,  0x3900,  0x001c,  0x0036,  0x001c, -0x7860,  0x38ce,  0x001d,
+	 0x003b,  0x001d, -0x7826,  0x389b,  0x001f,  0x003d,  0x001f, -0x77eb,
+	 0x3866,  0x0020,  0x0042,  0x0020, -0x77af,  0x3831,  0x0022,  0x0046,
+	 0x0022, -0x7770,  0x37fa,  0x0024,  0x004a,  0x0024, -0x772f,  0x37c1,
+	 0x0026,  0x004e,  0x0026, -0x76ed,  0x3787,  0x0029,  0x0051,  0x0029,
+	-0x76a9,  0x374c,  0x002b,  0x0056,  0x002b, -0x7663,  0x370f,  0x002e,
+	 0x005b,  0x002e, -0x761a,  0x36d1,  0x0030,  0x0061,  0x0030, -0x75d0,
+	 0x3691,  0x0033,  0x0066,  0x0033, -0x7583,  0x364f,  0x0036,  0x006b,
+	 0x0036, -0x7535,  0x360c,  0x0039,  0x0072,  0x0039, -0x74e3,  0x35c7,
+	 0x003c,  0x0079,  0x003c, -0x7490,  0x3581,  0x0040,  0x007f,  0x0040,
+	-0x743a,  0x3539,  0x0043,  0x0087,  0x0043, -0x73e2,  0x34ef,  0x0047,
+	 0x008e,  0x0047, -0x7387,  0x34a3,  0x004b,  0x0097,  0x004b, -0x7329,
+	 0x3456,  0x0050,  0x009e,  0x0050, -0x72c9,  0x3407,  0x0054,  0x00a8,
+	 0x0054, -0x7266,  0x33b6,  0x0059,  0x00b1,  0x0059, -0x7200,  0x3363,
+	 0x005e,  0x00bb,  0x005e, -0x7197,  0x330e,  0x0063,  0x00c6,  0x0063,
+	-0x712b,  0x32b7,  0x0069,  0x00d1,  0x0069, -0x70bc,  0x325f,  0x006f,
+	 0x00dd,  0x006f, -0x7049,  0x3204,  0x0075,  0x00e9,  0x0075, -0x6fd4,
+	 0x31a7,  0x007b,  0x00f7,  0x007b, -0x6f5b,  0x3148,  0x0082,  0x0106,
+	 0x0082, -0x6ede,  0x30e8,  0x008a,  0x0113,  0x008a, -0x6e5e,  0x3085,
+	 0x0091,  0x0123,  0x0091, -0x6ddb,  0x3020,  0x009a,  0x0132,  0x009a,
+	-0x6d53,  0x2fb9,  0x00a2,  0x0144,  0x00a2, -0x6cc8,  0x2f50,  0x00ab,
+	 0x0156,  0x00ab, -0x6c38,  0x2ee4,  0x00b4,  0x016a,  0x00b4, -0x6ba5,
+	 0x2e77,  0x00be,  0x017e,  0x00be, -0x6b0d,  0x2e07,  0x00c9,  0x0192,
+	 0x00c9, -0x6a71,  0x2d95,  0x00d4,  0x01a8,  0x00d4, -0x69d1,  0x2d21,
+	 0x00e0,  0x01bf,  0x00e0, -0x692c,  0x2cab,  0x00ec,  0x01d8,  0x00ec,
+	-0x6882,  0x2c32,  0x00f9,  0x01f2,  0x00f9, -0x67d4,  0x2bb8,  0x0107,
+	 0x020d,  0x0107, -0x6720,  0x2b3b,  0x0115,  0x0229,  0x0115, -0x6668,
+	 0x2abb,  0x0124,  0x0247,  0x0124, -0x65ab,  0x2a3a,  0x0134,  0x0266,
+	 0x0134, -0x64e8,  0x29b6,  0x0144,  0x028a,  0x0144, -0x641f,  0x2931,
+	 0x0156,  0x02ac,  0x0156, -0x6351,  0x28a9,  0x0168,  0x02d1,  0x0168,
+	-0x627e,  0x281f,  0x017c,  0x02f7,  0x017c, -0x61a4,  0x2793,  0x0190,
+	 0x031f,  0x0190, -0x60c5,  0x2704,  0x01a5,  0x034b,  0x01a5, -0x5fdf,
+	 0x2674,  0x01bc,  0x0376,  0x01bc, -0x5ef3,  0x25e1,  0x01d3,  0x03a7,
+	 0x01d3, -0x5e00,  0x254d,  0x01ec,  0x03d8,  0x01ec, -0x5d07,  0x24b7,
+	 0x0206,  0x040b,  0x0206, -0x5c07,  0x241e,  0x0221,  0x0442,  0x0221,
+	-0x5b00,  0x2384,  0x023e,  0x047a,  0x023e, -0x59f2,  0x22e8,  0x025c,
+	 0x04b7,  0x025c, -0x58dc,  0x224b,  0x027b,  0x04f6,  0x027b, -0x57bf,
+	 0x21ab,  0x029c,  0x0538,  0x029c, -0x569b,  0x210b,  0x02be,  0x057e,
+	 0x02be, -0x556e,  0x2068,  0x02e3,  0x05c6,  0x02e3, -0x5439,  0x1fc5,
+	 0x0309,  0x0611,  0x0309, -0x52fd,  0x1f20,  0x0330,  0x0662,  0x0330,
+	-0x51b7,  0x1e79,  0x035a,  0x06b5,  0x035a, -0x5069,  0x1dd2,  0x0386,
+	 0x070b,  0x0386, -0x4f13,  0x1d2a,  0x03b4,  0x0766,  0x03b4, -0x4db3,
+	 0x1c81,  0x03e3,  0x07c7,  0x03e3, -0x4c4a,  0x1bd7,  0x0416,  0x082a,
+	 0x0416, -0x4ad7,  0x1b2d,  0x044a,  0x0894,  0x044a, -0x495b,  0x1a83,
+	 0x0481,  0x0901,  0x0481, -0x47d5,  0x19d8,  0x04ba,  0x0974,  0x04ba,
+	-0x4645,  0x192d,  0x04f6,  0x09ec,  0x04f6, -0x44aa,  0x1882,  0x0535,
+	 0x0a69,  0x0535, -0x4305,  0x17d8,  0x0576,  0x0aed,  0x0576, -0x4155,
+	 0x172e,  0x05bb,  0x0b76,  0x05bb, -0x3f9a,  0x1686,  0x0602,  0x0c06,
+	 0x0602, -0x3dd4,  0x15de,  0x064d,  0x0c9b,  0x064d, -0x3c02,  0x1537,
+	 0x069c,  0x0d36,  0x069c, -0x3a24,  0x1492,  0x06ee,  0x0dda,  0x06ee,
+	-0x3839,  0x13ef,  0x0743,  0x0e85,  0x0743, -0x3643,  0x134e,  0x079c,
+	 0x0f38,  0x079c, -0x343f,  0x12af,  0x07f9,  0x0ff3,  0x07f9, -0x322e,
+	 0x1213,  0x085a,  0x10b6,  0x085a, -0x3010,  0x117a,  0x08c0,  0x1181,
+	 0x08c0, -0x2de4,  0x10e5,  0x092a,  0x1255,  0x092a, -0x2baa,  0x1053,
+	 0x0999,  0x1332,  0x0999, -0x2962,  0x0fc6,  0x0a0d,  0x1419,  0x0a0d,
+	-0x270a,  0x0f3d,  0x0a86,  0x150b,  0x0a86, -0x24a3,  0x0eba,  0x0b04,
+	 0x1608,  0x0b04, -0x222c,  0x0e3c,  0x0b88,  0x1710,  0x0b88, -0x1fa4,
+	 0x0dc4,  0x0c12,  0x1823,  0x0c12, -0x1d0c,  0x0d53,  0x0ca2,  0x1944,
+	 0x0ca2, -0x1a62,  0x0cea,  0x0d38,  0x1a72,  0x0d38, -0x17a6,  0x0c88
+};
+#endif
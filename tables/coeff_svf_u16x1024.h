@@ -0,0 +1,133 @@
+#ifndef COEFF_SVF_U16X1024_H
+#define COEFF_SVF_U16X1024_H
+const uint16_t coeff_svf_u16x1024[] PROGMEM = {
+	 0x00ce,  0x00cf,  0x00d0,  0x00d1,  0x00d2,  0x00d3,  0x00d4,  0x00d5,
+	 0x00d7,  0x00d8,  0x00d9,  0x00da,  0x00db,  0x00dc,  0x00dd,  0x00df,
+	 0x00e0,  0x00e1,  0x00e2,  0x00e3,  0x00e4,  0x00e6,  0x00e7,  0x00e8,
+	 0x00e9,  0x00ea,  0x00ec,  0x00ed,  0x00ee,  0x00ef,  0x00f0,  0x00f2,
+	 0x00f3,  0x00f4,  0x00f6,  0x00f7,  0x00f8,  0x00f9,  0x00fb,  0x00fc,
+	 0x00fd,  0x00ff,  0x0100,  0x0101,  0x0103,  0x0104,  0x0105,  0x0107,
+	 0x0108,  0x0109,  0x010b,  0x010c,  0x010e,  0x010f,  0x0110,  0x0112,
+	 0x0113,  0x0115,  0x0116,  0x0117,  0x0119,  0x011a,  0x011c,  0x011d,
+	 0x011f,  0x0120,  0x0122,  0x0123,  0x0125,  0x0126,  0x0128,  0x0129,
+	 0x012b,  0x012c,  0x012e,  0x0130,  0x0131,  0x0133,  0x0134,  0x0136,
+	 0x0138,  0x0139,  0x013b,  0x013c,  0x013e,  0x0140,  0x0141,  0x0143,
+	 0x0145,  0x0146,  0x0148,  0x014a,  0x014c,  0x014d,  0x014f,  0x0151,
+	 0x0153,  0x0154,  0x0156,  0x0158,  0x015a,  0x015b,  0x015d,  0x015f,
+	 0x0161,  0x0163,  0x0164,  0x0166,  0x0168,  0x016a,  0x016c,  0x016e,
+	 0x0170,  0x0172,  0x0174,  0x0176,  0x0177,  0x0179,  0x017b,  0x017d,
+	 0x017f,  0x0181,  0x0183,  0x0185,  0x0187,  0x0189,  0x018b,  0x018d,
+	 0x0190,  0x0192,  0x0194,  0x0196,  0x0198,  0x019a,  0x019c,  0x019e,
+	 0x01a0,  0x01a3,  0x01a5,  0x01a7,  0x01a9,  0x01ab,  0x01ae,  0x01b0,
+	 0x01b2,  0x01b4,  0x01b7,  0x01b9,  0x01bb,  0x01bd,  0x01c0,  0x01c2,
+	 0x01c4,  0x01c7,  0x01c9,  0x01cb,  0x01ce,  0x01d0,  0x01d3,  0x01d5,
+	 0x01d8,  0x01da,  0x01dc,  0x01df,  0x01e1,  0x01e4,  0x01e6,  0x01e9,
+	 0x01eb,  0x01ee,  0x01f1,  0x01f3,  0x01f6,  0x01f8,  0x01fb,  0x01fe,
+	 0x0200,  0x0203,  0x0206,  0x0208,  0x020b,  0x020e,  0x0210,  0x0213,
+	 0x0216,  0x0219,  0x021c,  0x021e,  0x0221,  0x0224,  0x0227,  0x022a,
+	 0x022d,  0x022f,  0x0232,  0x0235,  0x0238,  0x023b,  0x023e,  0x0241,
+	 0x0244,  0x0247,  0x024a,  0x024d,  0x0250,  0x0253,  0x0256,  0x025a,
+	 0x025d,  0x0260,  0x0263,  0x0266,  0x0269,  0x026c,  0x0270,  0x0273,
+	 0x0276,  0x0279,  0x027d,  0x0280,  0x0283,  0x0287,  0x028a,  0x028d,
+	 0x0291,  0x0294,  0x0298,  0x029b,  0x029f,  0x02a2,  0x02a6,  0x02a9,
+	 0x02ad,  0x02b0,  0x02b4,  0x02b7,  0x02bb,  0x02bf,  0x02c2,  0x02c6,
+	 0x02ca,  0x02cd,  0x02d1,  0x02d5,  0x02d9,  0x02dc,  0x02e0,  0x02e4,
+	 0x02e8,  0x02ec,  0x02f0,  0x02f3,  0x02f7,  0x02fb,  0x02ff,  0x0303,
+	 0x0307,  0x030b,  0x030f,  0x0313,  0x0318,  0x031c,  0x0320,  0x0324,
+	 0x0328,  0x032c,  0x0331,  0x0335,  0x0339,  0x033d,  0x0342,  0x0346,
+	 0x034a,  0x034f,  0x0353,  0x0357,  0x035c,  0x0360,  0x0365,  0x0369,
+	 0x036e,  0x0372,  0x0377,  0x037c,  0x0380,  0x0385,  0x038a,  0x038e,
+	 0x0393,  0x0398,  0x039d,  0x03a1,  0x03a6,  0x03ab,  0x03b0,  0x03b5,
+	 0x03ba,  0x03bf,  0x03c4,  0x03c9,  0x03ce,  0x03d3,  0x03d8,  0x03dd,
+	 0x03e2,  0x03e7,  0x03ec,  0x03f2,  0x03f7,  0x03fc,  0x0402,  0x0407,
+	 0x040c,  0x0412,  0x0417,  0x041c,  0x0422,  0x0427,  0x042d,  0x0432,
+	 0x0438,  0x043e,  0x0443,  0x0449,  0x044f,  0x0454,  0x045a,  0x0460,
+	 0x0466,  0x046c,  0x0471,  0x0477,  0x047d,  0x0483,  0x0489,  0x048f,
+	 0x0495,  0x049b,  0x04a2,  0x04a8,  0x04ae,  0x04b4,  0x04ba,  0x04c1,
+	 0x04c7,  0x04cd,  0x04d4,  0x04da,  0x04e1,  0x04e7,  0x04ee,  0x04f4,
+	 0x04fb,  0x0501,  0x0508,  0x050f,  0x0515,  0x051c,  0x0523,  0x052a,
+	 0x0531,  0x0538,  0x053f,  0x0546,  0x054d,  0x0554,  0x055b,  0x0562,
+	 0x0569,  0x0570,  0x0577,  0x057f,  0x0586,  0x058d,  0x0595,  0x059c,
+	 0x05a4,  0x05ab,  0x05b3,  0x05ba,  0x05c2,  0x05c9,  0x05d1,  0x05d9,
+	 0x05e1,  0x05e8,  0x05f0,  0x05f8,  0x0600,  0x0608,  0x0610,  0x0618,
+	 0x0620,  0x0628,  0x0631,  0x0639,  0x0641,  0x0649,  0x0652,  0x065a,
+	 0x0663,  0x066b,  0x0674,  0x067c,  0x0685,  0x068e,  0x0696,  0x069f,
+	 0x06a8,  0x06b1,  0x06ba,  0x06c3,  0x06cc,  0x06d5,  0x06de,  0x06e7,
+	 0x06f0,  0x06f9,  0x0702,  0x070c,  0x0715,  0x071f,  0x0728,  0x0732,
+	 0x073b,  0x0745,  0x074e,  0x0758,  0x0762,  0x076c,  0x0776,  0x0780,
+	 0x0789,  0x0794,  0x079e,  0x07a8,  0x07b2,  0x07bc,  0x07c6,  0x07d1,
+	 0x07db,  0x07e6,  0x07f0,  0x07fb,  0x0805,  0x0810,  0x081b,  0x0825,
+	 0x0830,  0x083b,  0x0846,  0x0851,  0x085c,  0x0867,  0x0873,  0x087e,
+	 0x0889,  0x0894,  0x08a0,  0x08ab,  0x08b7,  0x08c2,  0x08ce,  0x08da,
+	 0x08e6,  0x08f1,  0x08fd,  0x0909,  0x0915,  0x0921,  0x092e,  0x093a,
+	 0x0946,  0x0952,  0x095f,  0x096b,  0x0978,  0x0984,  0x0991,  0x099e,
+	 0x09ab,  0x09b7,  0x09c4,  0x09d1,  0x09de,  0x09ec,  0x09f9,  0x0a06,
+	 0x0a13,  0x0a21,  0x0a2e,  0x0a3c,  0x0a49,  0x0a57,  0x0a65,  0x0a73,
+	 0x0a81,  0x0a8f,  0x0a9d,  0x0aab,  0x0ab9,  0x0ac7,  0x0ad6,  0x0ae4,
+	 0x0af2,  0x0b01,  0x0b10,  0x0b1e,  0x0b2d,  0x0b3c,  0x0b4b,  0x0b5a,
+	 0x0b69,  0x0b78,  0x0b88,  0x0b97,  0x0ba6,  0x0bb6,  0x0bc5,  0x0bd5,
+	 0x0be5,  0x0bf5,  0x0c05,  0x0c15,  0x0c25,  0x0c35,  0x0c45,  0x0c55,
+	 0x0c66,  0x0c76,  0x0c87,  0x0c98,  0x0ca8,  0x0cb9,  0x0cca,  0x0cdb,
+	 0x0cec,  0x0cfe,  0x0d0f,  0x0d20,  0x0d32,  0x0d43,  0x0d55,  0x0d67,
+	 0x0d79,  0x0d8b,  0x0d9d,  0x0daf,  0x0dc1,  0x0dd3,  0x0de6,  0x0df8,
+	 0x0e0b,  0x0e1d,  0x0e30,  0x0e43,  0x0e56,  0x0e69,  0x0e7c,  0x0e90,
+	 0x0ea3,  0x0eb7,  0x0eca,  0x0ede,  0x0ef2,  0x0f06,  0x0f1a,  0x0f2e,
+	 0x0f42,  0x0f56,  0x0f6b,  0x0f7f,  0x0f94,  0x0fa9,  0x0fbe,  0x0fd3,
+	 0x0fe8,  0x0ffd,  0x1012,  0x1028,  0x103d,  0x1053,  0x1069,  0x107e,
+	 0x1094,  0x10ab,  0x10c1,  0x10d7,  0x10ee,  0x1104,  0x111b,  0x1132,
+	 0x1149,  0x1160,  0x1177,  0x118e,  0x11a5,  0x11bd,  0x11d5,  0x11ec,
+	 0x1204,  0x121c,  0x1234,  0x124d,  0x1265,  0x127e,  0x1296,  0x12af,
+	 0x12c8,  0x12e1,  0x12fa,  0x1314,  0x132d,  0x1347,  0x1360,  0x137a,
+	 0x1394,  0x13ae,  0x13c9,  0x13e3,  0x13fe,  0x1418,  0x1433,  0x144e,
+	 0x1469,  0x1484,  0x14a0,  0x14bb,  0x14d7,  0x14f3,  0x150f,  0x152b,
+	 0x1547,  0x1564,  0x1580,  0x159d,  0x15ba,  0x15d7,  0x15f4,  0x1611,
+	 0x162f,  0x164c,  0x166a,  0x1688,  0x16a6,  0x16c5,  0x16e3,  0x1702,
+	 0x1720,  0x173f,  0x175e,  0x177e,  0x179d,  0x17bd,  0x17dc,  0x17fc,
+	 0x181c,  0x183c,  0x185d,  0x187d,  0x189e,  0x18bf,  0x18e0,  0x1902,
+	 0x1923,  0x1945,  0x1966,  0x1988,  0x19ab,  0x19cd,  0x19ef,  0x1a12,
+	 0x1a35,  0x1a58,  0x1a7b,  0x1a9f,  0x1ac2,  0x1ae6,  0x1b0a,  0x1b2f,
+	 0x1b53,  0x1b78,  0x1b9c,  0x1bc1,  0x1be7,  0x1c0c,  0x1c32,  0x1c57,
+	 0x1c7d,  0x1ca3,  0x1cca,  0x1cf0,  0x1d17,  0x1d3e,  0x1d65,  0x1d8d,
+	 0x1db5,  0x1ddc,  0x1e04,  0x1e2d,  0x1e55,  0x1e7e,  0x1ea7,  0x1ed0,
+	 0x1ef9,  0x1f23,  0x1f4d,  0x1f77,  0x1fa1,  0x1fcb,  0x1ff6,  0x2021,
+	 0x204c,  0x2078,  0x20a3,  0x20cf,  0x20fb,  0x2127,  0x2154,  0x2181,
+	 0x21ae,  0x21db,  0x2209,  0x2237,  0x2265,  0x2293,  0x22c1,  0x22f0,
+	 0x231f,  0x234e,  0x237e,  0x23ae,  0x23de,  0x240e,  0x243f,  0x246f,
+	 0x24a1,  0x24d2,  0x2504,  0x2535,  0x2568,  0x259a,  0x25cd,  0x2600,
+	 0x2633,  0x2666,  0x269a,  0x26ce,  0x2703,  0x2737,  0x276c,  0x27a2,
+	 0x27d7,  0x280d,  0x2843,  0x2879,  0x28b0,  0x28e7,  0x291e,  0x2956,
+	 0x298e,  0x29c6,  0x29ff,  0x2a38,  0x2a71,  0x2aaa,  0x2ae4,  0x2b1e,
+	 0x2b58,  0x2b93,  0x2bce,  0x2c0a,  0x2c45,  0x2c81,  0x2cbe,  0x2cfa,
+	 0x2d37,  0x2d75,  0x2db2,  0x2df0,  0x2e2f,  0x2e6e,  0x2ead,  0x2eec,
+	 0x2f2c,  0x2f6c,  0x2fac,  0x2fed,  0x302e,  0x3070,  0x30b2,  0x30f4,
+	 0x3137,  0x317a,  0x31bd,  0x3201,  0x3245,  0x328a,  0x32cf,  0x3314,
+	 0x335a,  0x33a0,  0x33e6,  0x342d,  0x3475,  0x34bc,  0x3504,  0x354d,
+	 0x3596,  0x35df,  0x3629,  0x3673,  0x36bd,  0x3708,  0x3754,  0x37a0,
+	 0x37ec,  0x3839,  0x3886,  0x38d3,  0x3921,  0x3970,  0x39bf,  0x3a0e,
+	 0x3a5e,  0x3aae,  0x3aff,  0x3b50,  0x3ba2,  0x3bf4,  0x3c46,  0x3c9a,
+	 0x3ced,  0x3d41,  0x3d96,  0x3deb,  0x3e40,  0x3e96,  0x3eed,  0x3f44,
+	 0x3f9b,  0x3ff3,  0x404c,  0x40a5,  0x40fe,  0x4158,  0x41b3,  0x420e,
+	 0x426a,  0x42c6,  0x4323,  0x4380,  0x43de,  0x443c,  0x449b,  0x44fb,
+	 0x455b,  0x45bc,  0x461d,  0x467f,  0x46e1,  0x4744,  0x47a8,  0x480c,
+	 0x4871,  0x48d6,  0x493c,  0x49a3,  0x4a0a,  0x4a72,  0x4ada,  0x4b44,
+	 0x4bad,  0x4c18,  0x4c83,  0x4cef,  0x4d5b,  0x4dc8,  0x4e36,  0x4ea4,
+	 0x4f13,  0x4f83,  0x4ff3,  0x5064,  0x50d6,  0x5149,  0x51bc,  0x5230,
+	 0x52a5,  0x531a,  0x5390,  0x5407,  0x547f,  0x54f7,  0x5570,  0x55ea,
+	 0x5665,  0x56e0,  0x575c,  0x57d9,  0x5857,  0x58d6,  0x5955,  0x59d5,
+	 0x5a57,  0x5ad8,  0x5b5b,  0x5bdf,  0x5c63,  0x5ce8,  0x5d6f,  0x5df6,
+	 0x5e7e,  0x5f06,  0x5f90,  0x601b,  0x60a6,  0x6133,  0x61c0,  0x624e,
+	 0x62de,  0x636e,  0x63ff,  0x6491,  0x6524,  0x65b9,  0x664e,  0x66e4,
+	 0x677b,  0x6813,  0x68ad,  0x6947,  0x69e2,  0x6a7f,  0x6b1c,  0x6bbb,
+	 0x6c5a,  0x6cfb,  0x6d9d,  0x6e40,  0x6ee4,  0x6f8a,  0x7030,  0x70d8,
+	 0x7181,  0x722b,  0x72d6,  0x7383,  0x7431,  0x74e0,  0x7590,  0x7642,
+	 0x76f4,  0x77a9,  0x785e,  0x7915,  0x79cd,  0x7a87,  0x7b42,  0x7bfe,
+	 0x7cbc,  0x7d7b,  0x7e3b,  0x7efd,  0x7fc1,  0x8086,  0x814c,  0x8214,
+	 0x82de,  0x83a9,  0x8476,  0x8544,  0x8614,  0x86e5,  0x87b8,  0x888d,
+	 0x8964,  0x8a3c,  0x8b16,  0x8bf2,  0x8ccf,  0x8dae,  0x8e8f,  0x8f72,
+	 0x9057,  0x913d,  0x9226,  0x9310,  0x93fd,  0x94eb,  0x95db,  0x96ce,
+	 0x97c2,  0x98b9,  0x99b1,  0x9aac,  0x9ba9,  0x9ca8,  0x9da9,  0x9ead,
+	 0x9fb3,  0xa0bb,  0xa1c5,  0xa2d2,  0xa3e2,  0xa4f3,  0xa607,  0xa71e,
+	 0xa837,  0xa953,  0xaa72,  0xab93,  0xacb7,  0xaddd,  0xaf06,  0xb032,
+	 0xb161,  0xb293,  0xb3c8,  0xb500,  0xb63b,  0xb779,  0xb8ba,  0xb9fe
+};
+#endif
@@ -0,0 +1,133 @@
+#ifndef DAMPING_U16X1024_H
+#define DAMPING_U16X1024_H
+const uint16_t damping_u16x1024[] PROGMEM = {
+	 0xffff,  0xff13,  0xfe28,  0xfd3e,  0xfc55,  0xfb6c,  0xfa84,  0xf99d,
+	 0xf8b7,  0xf7d2,  0xf6ee,  0xf60a,  0xf528,  0xf446,  0xf365,  0xf284,
+	 0xf1a5,  0xf0c6,  0xefe8,  0xef0b,  0xee2f,  0xed54,  0xec79,  0xeb9f,
+	 0xeac6,  0xe9ee,  0xe916,  0xe83f,  0xe769,  0xe694,  0xe5c0,  0xe4ec,
+	 0xe419,  0xe347,  0xe275,  0xe1a5,  0xe0d5,  0xe006,  0xdf37,  0xde69,
+	 0xdd9c,  0xdcd0,  0xdc05,  0xdb3a,  0xda70,  0xd9a7,  0xd8de,  0xd816,
+	 0xd74f,  0xd689,  0xd5c3,  0xd4fe,  0xd43a,  0xd376,  0xd2b4,  0xd1f1,
+	 0xd130,  0xd06f,  0xcfaf,  0xcef0,  0xce31,  0xcd73,  0xccb6,  0xcbf9,
+	 0xcb3d,  0xca82,  0xc9c7,  0xc90d,  0xc854,  0xc79b,  0xc6e4,  0xc62c,
+	 0xc576,  0xc4c0,  0xc40a,  0xc356,  0xc2a2,  0xc1ee,  0xc13c,  0xc08a,
+	 0xbfd8,  0xbf27,  0xbe77,  0xbdc8,  0xbd19,  0xbc6b,  0xbbbd,  0xbb10,
+	 0xba64,  0xb9b8,  0xb90d,  0xb862,  0xb7b8,  0xb70f,  0xb666,  0xb5be,
+	 0xb517,  0xb470,  0xb3ca,  0xb324,  0xb27f,  0xb1db,  0xb137,  0xb093,
+	 0xaff1,  0xaf4f,  0xaead,  0xae0c,  0xad6c,  0xaccc,  0xac2d,  0xab8e,
+	 0xaaf0,  0xaa52,  0xa9b5,  0xa919,  0xa87d,  0xa7e2,  0xa747,  0xa6ad,
+	 0xa614,  0xa57b,  0xa4e2,  0xa44a,  0xa3b3,  0xa31c,  0xa286,  0xa1f0,
+	 0xa15b,  0xa0c6,  0xa032,  0x9f9e,  0x9f0b,  0x9e79,  0x9de7,  0x9d55,
+	 0x9cc4,  0x9c34,  0x9ba4,  0x9b14,  0x9a85,  0x99f7,  0x9969,  0x98dc,
+	 0x984f,  0x97c3,  0x9737,  0x96ab,  0x9621,  0x9596,  0x950c,  0x9483,
+	 0x93fa,  0x9372,  0x92ea,  0x9263,  0x91dc,  0x9155,  0x90cf,  0x904a,
+	 0x8fc5,  0x8f41,  0x8ebd,  0x8e39,  0x8db6,  0x8d33,  0x8cb1,  0x8c30,
+	 0x8bae,  0x8b2e,  0x8aad,  0x8a2e,  0x89ae,  0x892f,  0x88b1,  0x8833,
+	 0x87b6,  0x8739,  0x86bc,  0x8640,  0x85c4,  0x8549,  0x84ce,  0x8454,
+	 0x83da,  0x8360,  0x82e7,  0x826f,  0x81f6,  0x817f,  0x8107,  0x8090,
+	 0x801a,  0x7fa4,  0x7f2e,  0x7eb9,  0x7e44,  0x7dd0,  0x7d5c,  0x7ce9,
+	 0x7c75,  0x7c03,  0x7b90,  0x7b1f,  0x7aad,  0x7a3c,  0x79cb,  0x795b,
+	 0x78eb,  0x787c,  0x780d,  0x779e,  0x7730,  0x76c2,  0x7655,  0x75e8,
+	 0x757b,  0x750f,  0x74a3,  0x7438,  0x73cd,  0x7362,  0x72f7,  0x728e,
+	 0x7224,  0x71bb,  0x7152,  0x70ea,  0x7082,  0x701a,  0x6fb3,  0x6f4c,
+	 0x6ee5,  0x6e7f,  0x6e19,  0x6db4,  0x6d4f,  0x6cea,  0x6c85,  0x6c21,
+	 0x6bbe,  0x6b5b,  0x6af8,  0x6a95,  0x6a33,  0x69d1,  0x6970,  0x690e,
+	 0x68ae,  0x684d,  0x67ed,  0x678d,  0x672e,  0x66cf,  0x6670,  0x6612,
+	 0x65b4,  0x6556,  0x64f8,  0x649b,  0x643f,  0x63e2,  0x6386,  0x632b,
+	 0x62cf,  0x6274,  0x6219,  0x61bf,  0x6165,  0x610b,  0x60b2,  0x6059,
+	 0x6000,  0x5fa7,  0x5f4f,  0x5ef8,  0x5ea0,  0x5e49,  0x5df2,  0x5d9b,
+	 0x5d45,  0x5cef,  0x5c9a,  0x5c44,  0x5bef,  0x5b9a,  0x5b46,  0x5af2,
+	 0x5a9e,  0x5a4b,  0x59f7,  0x59a5,  0x5952,  0x5900,  0x58ae,  0x585c,
+	 0x580b,  0x57b9,  0x5769,  0x5718,  0x56c8,  0x5678,  0x5628,  0x55d9,
+	 0x558a,  0x553b,  0x54ec,  0x549e,  0x5450,  0x5402,  0x53b5,  0x5368,
+	 0x531b,  0x52ce,  0x5282,  0x5236,  0x51ea,  0x519f,  0x5154,  0x5109,
+	 0x50be,  0x5074,  0x5029,  0x4fe0,  0x4f96,  0x4f4d,  0x4f04,  0x4ebb,
+	 0x4e72,  0x4e2a,  0x4de2,  0x4d9a,  0x4d53,  0x4d0b,  0x4cc4,  0x4c7e,
+	 0x4c37,  0x4bf1,  0x4bab,  0x4b65,  0x4b20,  0x4adb,  0x4a96,  0x4a51,
+	 0x4a0c,  0x49c8,  0x4984,  0x4940,  0x48fd,  0x48ba,  0x4877,  0x4834,
+	 0x47f1,  0x47af,  0x476d,  0x472b,  0x46ea,  0x46a8,  0x4667,  0x4626,
+	 0x45e6,  0x45a5,  0x4565,  0x4525,  0x44e5,  0x44a6,  0x4467,  0x4428,
+	 0x43e9,  0x43aa,  0x436c,  0x432e,  0x42f0,  0x42b2,  0x4275,  0x4237,
+	 0x41fa,  0x41be,  0x4181,  0x4145,  0x4109,  0x40cd,  0x4091,  0x4055,
+	 0x401a,  0x3fdf,  0x3fa4,  0x3f6a,  0x3f2f,  0x3ef5,  0x3ebb,  0x3e81,
+	 0x3e48,  0x3e0e,  0x3dd5,  0x3d9c,  0x3d63,  0x3d2b,  0x3cf2,  0x3cba,
+	 0x3c82,  0x3c4a,  0x3c13,  0x3bdc,  0x3ba4,  0x3b6d,  0x3b37,  0x3b00,
+	 0x3aca,  0x3a94,  0x3a5e,  0x3a28,  0x39f2,  0x39bd,  0x3988,  0x3953,
+	 0x391e,  0x38e9,  0x38b5,  0x3880,  0x384c,  0x3819,  0x37e5,  0x37b1,
+	 0x377e,  0x374b,  0x3718,  0x36e5,  0x36b3,  0x3680,  0x364e,  0x361c,
+	 0x35ea,  0x35b8,  0x3587,  0x3556,  0x3524,  0x34f3,  0x34c3,  0x3492,
+	 0x3462,  0x3431,  0x3401,  0x33d1,  0x33a2,  0x3372,  0x3343,  0x3313,
+	 0x32e4,  0x32b5,  0x3287,  0x3258,  0x322a,  0x31fb,  0x31cd,  0x31a0,
+	 0x3172,  0x3144,  0x3117,  0x30ea,  0x30bd,  0x3090,  0x3063,  0x3036,
+	 0x300a,  0x2fde,  0x2fb2,  0x2f86,  0x2f5a,  0x2f2e,  0x2f03,  0x2ed7,
+	 0x2eac,  0x2e81,  0x2e56,  0x2e2c,  0x2e01,  0x2dd7,  0x2dac,  0x2d82,
+	 0x2d58,  0x2d2f,  0x2d05,  0x2cdc,  0x2cb2,  0x2c89,  0x2c60,  0x2c37,
+	 0x2c0e,  0x2be6,  0x2bbd,  0x2b95,  0x2b6d,  0x2b45,  0x2b1d,  0x2af5,
+	 0x2ace,  0x2aa6,  0x2a7f,  0x2a58,  0x2a31,  0x2a0a,  0x29e3,  0x29bd,
+	 0x2996,  0x2970,  0x294a,  0x2924,  0x28fe,  0x28d8,  0x28b2,  0x288d,
+	 0x2867,  0x2842,  0x281d,  0x27f8,  0x27d3,  0x27af,  0x278a,  0x2766,
+	 0x2741,  0x271d,  0x26f9,  0x26d5,  0x26b1,  0x268e,  0x266a,  0x2647,
+	 0x2623,  0x2600,  0x25dd,  0x25ba,  0x2598,  0x2575,  0x2552,  0x2530,
+	 0x250e,  0x24ec,  0x24ca,  0x24a8,  0x2486,  0x2464,  0x2443,  0x2421,
+	 0x2400,  0x23df,  0x23be,  0x239d,  0x237c,  0x235b,  0x233b,  0x231a,
+	 0x22fa,  0x22da,  0x22ba,  0x229a,  0x227a,  0x225a,  0x223a,  0x221b,
+	 0x21fb,  0x21dc,  0x21bd,  0x219e,  0x217f,  0x2160,  0x2141,  0x2123,
+	 0x2104,  0x20e6,  0x20c7,  0x20a9,  0x208b,  0x206d,  0x204f,  0x2031,
+	 0x2014,  0x1ff6,  0x1fd9,  0x1fbb,  0x1f9e,  0x1f81,  0x1f64,  0x1f47,
+	 0x1f2a,  0x1f0d,  0x1ef1,  0x1ed4,  0x1eb8,  0x1e9c,  0x1e7f,  0x1e63,
+	 0x1e47,  0x1e2b,  0x1e10,  0x1df4,  0x1dd8,  0x1dbd,  0x1da1,  0x1d86,
+	 0x1d6b,  0x1d50,  0x1d35,  0x1d1a,  0x1cff,  0x1ce4,  0x1cca,  0x1caf,
+	 0x1c95,  0x1c7a,  0x1c60,  0x1c46,  0x1c2c,  0x1c12,  0x1bf8,  0x1bde,
+	 0x1bc5,  0x1bab,  0x1b92,  0x1b78,  0x1b5f,  0x1b46,  0x1b2d,  0x1b14,
+	 0x1afb,  0x1ae2,  0x1ac9,  0x1ab0,  0x1a98,  0x1a7f,  0x1a67,  0x1a4e,
+	 0x1a36,  0x1a1e,  0x1a06,  0x19ee,  0x19d6,  0x19be,  0x19a7,  0x198f,
+	 0x1977,  0x1960,  0x1949,  0x1931,  0x191a,  0x1903,  0x18ec,  0x18d5,
+	 0x18be,  0x18a7,  0x1890,  0x187a,  0x1863,  0x184d,  0x1836,  0x1820,
+	 0x180a,  0x17f4,  0x17de,  0x17c8,  0x17b2,  0x179c,  0x1786,  0x1771,
+	 0x175b,  0x1745,  0x1730,  0x171b,  0x1705,  0x16f0,  0x16db,  0x16c6,
+	 0x16b1,  0x169c,  0x1687,  0x1672,  0x165e,  0x1649,  0x1635,  0x1620,
+	 0x160c,  0x15f7,  0x15e3,  0x15cf,  0x15bb,  0x15a7,  0x1593,  0x157f,
+	 0x156b,  0x1558,  0x1544,  0x1530,  0x151d,  0x1509,  0x14f6,  0x14e3,
+	 0x14cf,  0x14bc,  0x14a9,  0x1496,  0x1483,  0x1470,  0x145d,  0x144b,
+	 0x1438,  0x1425,  0x1413,  0x1400,  0x13ee,  0x13db,  0x13c9,  0x13b7,
+	 0x13a5,  0x1393,  0x1381,  0x136f,  0x135d,  0x134b,  0x1339,  0x1327,
+	 0x1316,  0x1304,  0x12f3,  0x12e1,  0x12d0,  0x12be,  0x12ad,  0x129c,
+	 0x128b,  0x127a,  0x1269,  0x1258,  0x1247,  0x1236,  0x1225,  0x1214,
+	 0x1204,  0x11f3,  0x11e3,  0x11d2,  0x11c2,  0x11b1,  0x11a1,  0x1191,
+	 0x1181,  0x1170,  0x1160,  0x1150,  0x1140,  0x1131,  0x1121,  0x1111,
+	 0x1101,  0x10f2,  0x10e2,  0x10d2,  0x10c3,  0x10b3,  0x10a4,  0x1095,
+	 0x1085,  0x1076,  0x1067,  0x1058,  0x1049,  0x103a,  0x102b,  0x101c,
+	 0x100d,  0x0ffe,  0x0ff0,  0x0fe1,  0x0fd2,  0x0fc4,  0x0fb5,  0x0fa7,
+	 0x0f98,  0x0f8a,  0x0f7c,  0x0f6d,  0x0f5f,  0x0f51,  0x0f43,  0x0f35,
+	 0x0f27,  0x0f19,  0x0f0b,  0x0efd,  0x0eef,  0x0ee1,  0x0ed4,  0x0ec6,
+	 0x0eb9,  0x0eab,  0x0e9d,  0x0e90,  0x0e83,  0x0e75,  0x0e68,  0x0e5b,
+	 0x0e4d,  0x0e40,  0x0e33,  0x0e26,  0x0e19,  0x0e0c,  0x0dff,  0x0df2,
+	 0x0de5,  0x0dd8,  0x0dcc,  0x0dbf,  0x0db2,  0x0da6,  0x0d99,  0x0d8d,
+	 0x0d80,  0x0d74,  0x0d67,  0x0d5b,  0x0d4f,  0x0d42,  0x0d36,  0x0d2a,
+	 0x0d1e,  0x0d12,  0x0d06,  0x0cfa,  0x0cee,  0x0ce2,  0x0cd6,  0x0cca,
+	 0x0cbe,  0x0cb3,  0x0ca7,  0x0c9b,  0x0c90,  0x0c84,  0x0c79,  0x0c6d,
+	 0x0c62,  0x0c56,  0x0c4b,  0x0c3f,  0x0c34,  0x0c29,  0x0c1e,  0x0c13,
+	 0x0c07,  0x0bfc,  0x0bf1,  0x0be6,  0x0bdb,  0x0bd0,  0x0bc6,  0x0bbb,
+	 0x0bb0,  0x0ba5,  0x0b9a,  0x0b90,  0x0b85,  0x0b7a,  0x0b70,  0x0b65,
+	 0x0b5b,  0x0b50,  0x0b46,  0x0b3c,  0x0b31,  0x0b27,  0x0b1d,  0x0b12,
+	 0x0b08,  0x0afe,  0x0af4,  0x0aea,  0x0ae0,  0x0ad6,  0x0acc,  0x0ac2,
+	 0x0ab8,  0x0aae,  0x0aa4,  0x0a9a,  0x0a91,  0x0a87,  0x0a7d,  0x0a73,
+	 0x0a6a,  0x0a60,  0x0a57,  0x0a4d,  0x0a44,  0x0a3a,  0x0a31,  0x0a27,
+	 0x0a1e,  0x0a15,  0x0a0b,  0x0a02,  0x09f9,  0x09f0,  0x09e7,  0x09dd,
+	 0x09d4,  0x09cb,  0x09c2,  0x09b9,  0x09b0,  0x09a7,  0x099e,  0x0996,
+	 0x098d,  0x0984,  0x097b,  0x0972,  0x096a,  0x0961,  0x0958,  0x0950,
+	 0x0947,  0x093f,  0x0936,  0x092e,  0x0925,  0x091d,  0x0914,  0x090c,
+	 0x0904,  0x08fb,  0x08f3,  0x08eb,  0x08e3,  0x08db,  0x08d2,  0x08ca,
+	 0x08c2,  0x08ba,  0x08b2,  0x08aa,  0x08a2,  0x089a,  0x0892,  0x088a,
+	 0x0882,  0x087b,  0x0873,  0x086b,  0x0863,  0x085b,  0x0854,  0x084c,
+	 0x0844,  0x083d,  0x0835,  0x082e,  0x0826,  0x081f,  0x0817,  0x0810,
+	 0x0808,  0x0801,  0x07f9,  0x07f2,  0x07eb,  0x07e3,  0x07dc,  0x07d5,
+	 0x07ce,  0x07c7,  0x07bf,  0x07b8,  0x07b1,  0x07aa,  0x07a3,  0x079c,
+	 0x0795,  0x078e,  0x0787,  0x0780,  0x0779,  0x0772,  0x076b,  0x0765,
+	 0x075e,  0x0757,  0x0750,  0x0749,  0x0743,  0x073c,  0x0735,  0x072f,
+	 0x0728,  0x0722,  0x071b,  0x0714,  0x070e,  0x0707,  0x0701,  0x06fa,
+	 0x06f4,  0x06ee,  0x06e7,  0x06e1,  0x06db,  0x06d4,  0x06ce,  0x06c8,
+	 0x06c1,  0x06bb,  0x06b5,  0x06af,  0x06a9,  0x06a3,  0x069c,  0x0696,
+	 0x0690,  0x068a,  0x0684,  0x067e,  0x0678,  0x0672,  0x066c,  0x0666
+};
+#endif
@@ -0,0 +1,21 @@
+#ifndef EXP10000_U16X128_H
+#define EXP10000_U16X128_H
+const uint16_t exp10000_u16x128[] PROGMEM = {
+	 0x0007,  0x0007,  0x0008,  0x0008,  0x0009,  0x0009,  0x000a,  0x000b,
+	 0x000c,  0x000d,  0x000e,  0x000f,  0x0010,  0x0011,  0x0012,  0x0013,
+	 0x0015,  0x0016,  0x0018,  0x001a,  0x001c,  0x001e,  0x0020,  0x0023,
+	 0x0025,  0x0028,  0x002b,  0x002e,  0x0032,  0x0036,  0x003a,  0x003e,
+	 0x0043,  0x0048,  0x004d,  0x0053,  0x0059,  0x0060,  0x0067,  0x006f,
+	 0x0077,  0x0080,  0x008a,  0x0094,  0x009f,  0x00ab,  0x00b8,  0x00c6,
+	 0x00d5,  0x00e5,  0x00f6,  0x0109,  0x011d,  0x0132,  0x0149,  0x0162,
+	 0x017c,  0x0199,  0x01b8,  0x01d9,  0x01fc,  0x0223,  0x024c,  0x0278,
+	 0x02a8,  0x02db,  0x0312,  0x034d,  0x038c,  0x03d1,  0x041a,  0x0469,
+	 0x04be,  0x0519,  0x057b,  0x05e5,  0x0656,  0x06d0,  0x0754,  0x07e1,
+	 0x0878,  0x091c,  0x09cb,  0x0a88,  0x0b52,  0x0c2c,  0x0d17,  0x0e13,
+	 0x0f22,  0x1045,  0x117e,  0x12cf,  0x1439,  0x15bf,  0x1762,  0x1924,
+	 0x1b08,  0x1d10,  0x1f40,  0x219a,  0x2421,  0x26d8,  0x29c4,  0x2ce9,
+	 0x3049,  0x33eb,  0x37d3,  0x3c06,  0x4089,  0x4564,  0x4a9c,  0x5039,
+	 0x5642,  0x5cbf,  0x63b8,  0x6b39,  0x7349,  0x7bf5,  0x8548,  0x8f4e,
+	 0x9a16,  0xa5ad,  0xb223,  0xbf89,  0xcdf1,  0xdd6f,  0xee16,  0xffff
+};
+#endif
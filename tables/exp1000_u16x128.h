@@ -0,0 +1,21 @@
+#ifndef EXP1000_U16X128_H
+#define EXP1000_U16X128_H
+const uint16_t exp1000_u16x128[] PROGMEM = {
+	 0x0042,  0x0045,  0x0049,  0x004d,  0x0051,  0x0056,  0x005b,  0x0060,
+	 0x0065,  0x006b,  0x0071,  0x0077,  0x007e,  0x0085,  0x008c,  0x0094,
+	 0x009c,  0x00a5,  0x00ae,  0x00b8,  0x00c2,  0x00cd,  0x00d9,  0x00e5,
+	 0x00f2,  0x00ff,  0x010e,  0x011d,  0x012d,  0x013d,  0x014f,  0x0162,
+	 0x0176,  0x018a,  0x01a1,  0x01b8,  0x01d0,  0x01ea,  0x0206,  0x0223,
+	 0x0241,  0x0262,  0x0284,  0x02a8,  0x02ce,  0x02f6,  0x0320,  0x034d,
+	 0x037c,  0x03ae,  0x03e2,  0x041a,  0x0455,  0x0493,  0x04d4,  0x0519,
+	 0x0562,  0x05af,  0x0601,  0x0656,  0x06b1,  0x0711,  0x0776,  0x07e1,
+	 0x0852,  0x08c9,  0x0946,  0x09cb,  0x0a57,  0x0aeb,  0x0b87,  0x0c2c,
+	 0x0cda,  0x0d92,  0x0e55,  0x0f22,  0x0ffa,  0x10df,  0x11d0,  0x12cf,
+	 0x13dc,  0x14f9,  0x1625,  0x1762,  0x18b0,  0x1a11,  0x1b86,  0x1d10,
+	 0x1eb0,  0x2067,  0x2237,  0x2421,  0x2626,  0x2848,  0x2a88,  0x2ce9,
+	 0x2f6b,  0x3212,  0x34de,  0x37d3,  0x3af2,  0x3e3d,  0x41b8,  0x4564,
+	 0x4945,  0x4d5e,  0x51b1,  0x5642,  0x5b14,  0x602b,  0x658c,  0x6b39,
+	 0x7137,  0x778b,  0x7e3a,  0x8548,  0x8cbb,  0x9499,  0x9ce8,  0xa5ad,
+	 0xaef0,  0xb8b7,  0xc30a,  0xcdf1,  0xd974,  0xe59c,  0xf272,  0xffff
+};
+#endif
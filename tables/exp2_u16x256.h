@@ -0,0 +1,37 @@
+#ifndef EXP2_U16X256_H
+#define EXP2_U16X256_H
+const uint16_t exp2_u16x256[] PROGMEM = {
+	 0x0000,  0x00b2,  0x0164,  0x0216,  0x02ca,  0x037d,  0x0431,  0x04e6,
+	 0x059b,  0x0651,  0x0707,  0x07bd,  0x0874,  0x092c,  0x09e4,  0x0a9c,
+	 0x0b55,  0x0c0f,  0x0cc9,  0x0d84,  0x0e3f,  0x0efa,  0x0fb6,  0x1073,
+	 0x1130,  0x11ee,  0x12ac,  0x136a,  0x142a,  0x14e9,  0x15a9,  0x166a,
+	 0x172b,  0x17ed,  0x18af,  0x1972,  0x1a36,  0x1afa,  0x1bbe,  0x1c83,
+	 0x1d48,  0x1e0e,  0x1ed5,  0x1f9c,  0x2064,  0x212c,  0x21f4,  0x22be,
+	 0x2388,  0x2452,  0x251d,  0x25e8,  0x26b4,  0x2781,  0x284e,  0x291b,
+	 0x29ea,  0x2ab8,  0x2b88,  0x2c58,  0x2d28,  0x2df9,  0x2ecb,  0x2f9d,
+	 0x3070,  0x3143,  0x3217,  0x32eb,  0x33c0,  0x3496,  0x356c,  0x3643,
+	 0x371a,  0x37f2,  0x38cb,  0x39a4,  0x3a7d,  0x3b58,  0x3c33,  0x3d0e,
+	 0x3dea,  0x3ec7,  0x3fa4,  0x4082,  0x4160,  0x423f,  0x431f,  0x43ff,
+	 0x44e0,  0x45c2,  0x46a4,  0x4787,  0x486a,  0x494e,  0x4a32,  0x4b18,
+	 0x4bfd,  0x4ce4,  0x4dcb,  0x4eb3,  0x4f9b,  0x5084,  0x516d,  0x5258,
+	 0x5342,  0x542e,  0x551a,  0x5607,  0x56f4,  0x57e2,  0x58d1,  0x59c0,
+	 0x5ab0,  0x5ba1,  0x5c92,  0x5d84,  0x5e77,  0x5f6a,  0x605e,  0x6152,
+	 0x6248,  0x633d,  0x6434,  0x652b,  0x6623,  0x671c,  0x6815,  0x690f,
+	 0x6a09,  0x6b05,  0x6c01,  0x6cfd,  0x6dfb,  0x6ef9,  0x6ff7,  0x70f7,
+	 0x71f7,  0x72f8,  0x73f9,  0x74fb,  0x75fe,  0x7702,  0x7806,  0x790b,
+	 0x7a11,  0x7b17,  0x7c1e,  0x7d26,  0x7e2f,  0x7f38,  0x8042,  0x814d,
+	 0x8258,  0x8364,  0x8471,  0x857f,  0x868d,  0x879c,  0x88ac,  0x89bd,
+	 0x8ace,  0x8be0,  0x8cf3,  0x8e06,  0x8f1a,  0x902f,  0x9145,  0x925c,
+	 0x9373,  0x948b,  0x95a4,  0x96bd,  0x97d8,  0x98f3,  0x9a0e,  0x9b2b,
+	 0x9c48,  0x9d67,  0x9e86,  0x9fa5,  0xa0c6,  0xa1e7,  0xa309,  0xa42c,
+	 0xa550,  0xa674,  0xa799,  0xa8bf,  0xa9e6,  0xab0e,  0xac36,  0xad5f,
+	 0xae89,  0xafb4,  0xb0e0,  0xb20c,  0xb339,  0xb468,  0xb596,  0xb6c6,
+	 0xb7f7,  0xb928,  0xba5a,  0xbb8d,  0xbcc1,  0xbdf6,  0xbf2b,  0xc062,
+	 0xc199,  0xc2d1,  0xc40a,  0xc544,  0xc67e,  0xc7ba,  0xc8f6,  0xca33,
+	 0xcb71,  0xccb0,  0xcdf0,  0xcf31,  0xd072,  0xd1b4,  0xd2f8,  0xd43c,
+	 0xd581,  0xd6c7,  0xd80d,  0xd955,  0xda9e,  0xdbe7,  0xdd31,  0xde7c,
+	 0xdfc9,  0xe116,  0xe263,  0xe3b2,  0xe502,  0xe653,  0xe7a4,  0xe8f7,
+	 0xea4a,  0xeb9e,  0xecf4,  0xee4a,  0xefa1,  0xf0f9,  0xf252,  0xf3ac,
+	 0xf506,  0xf662,  0xf7bf,  0xf91d,  0xfa7b,  0xfbdb,  0xfd3b,  0xfe9d
+};
+#endif
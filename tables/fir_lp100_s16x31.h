@@ -0,0 +1,7 @@
+#ifndef FIR_LP100_S16X31_H
+#define FIR_LP100_S16X31_H
+const int16_t fir_lp100_s16x31[] PROGMEM = {
+	 0x0000,  0x0005,  0x0014,  0x002c,  0x0035,  0x0000, -0x009a, -0x018a,
+	-0x0257, -0x0224,  0x0000,  0x0491,  0x0b1b,  0x1220,  0x178e,  0x1996
+};
+#endif
@@ -0,0 +1,6 @@
+#ifndef HALFBAND_S16X23_H
+#define HALFBAND_S16X23_H
+const int16_t halfband_s16x23[] PROGMEM = {
+	 0x277f, -0x0a3b,  0x039c, -0x0112,  0x0034, -0x0002
+};
+#endif
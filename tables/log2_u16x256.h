@@ -0,0 +1,37 @@
+#ifndef LOG2_U16X256_H
+#define LOG2_U16X256_H
+const uint16_t log2_u16x256[] PROGMEM = {
+	 0x0000,  0x0171,  0x02e0,  0x044e,  0x05ba,  0x0725,  0x088e,  0x09f7,
+	 0x0b5d,  0x0cc3,  0x0e27,  0x0f8a,  0x10eb,  0x124b,  0x13aa,  0x1508,
+	 0x1664,  0x17bf,  0x1919,  0x1a71,  0x1bc8,  0x1d1e,  0x1e73,  0x1fc6,
+	 0x2119,  0x226a,  0x23b9,  0x2508,  0x2656,  0x27a2,  0x28ed,  0x2a37,
+	 0x2b80,  0x2cc8,  0x2e0e,  0x2f54,  0x3098,  0x31db,  0x331e,  0x345f,
+	 0x359f,  0x36dd,  0x381b,  0x3958,  0x3a94,  0x3bce,  0x3d08,  0x3e40,
+	 0x3f78,  0x40ae,  0x41e4,  0x4318,  0x444c,  0x457e,  0x46b0,  0x47e0,
+	 0x4910,  0x4a3e,  0x4b6c,  0x4c99,  0x4dc4,  0x4eef,  0x5019,  0x5142,
+	 0x526a,  0x5391,  0x54b7,  0x55dc,  0x5700,  0x5823,  0x5946,  0x5a67,
+	 0x5b88,  0x5ca8,  0x5dc7,  0x5ee5,  0x6002,  0x611f,  0x623a,  0x6355,
+	 0x646f,  0x6587,  0x66a0,  0x67b7,  0x68cd,  0x69e3,  0x6af8,  0x6c0c,
+	 0x6d1f,  0x6e32,  0x6f43,  0x7054,  0x7164,  0x7274,  0x7382,  0x7490,
+	 0x759d,  0x76a9,  0x77b5,  0x78bf,  0x79c9,  0x7ad2,  0x7bdb,  0x7ce3,
+	 0x7dea,  0x7ef0,  0x7ff5,  0x80fa,  0x81fe,  0x8302,  0x8404,  0x8506,
+	 0x8608,  0x8708,  0x8808,  0x8907,  0x8a06,  0x8b04,  0x8c01,  0x8cfd,
+	 0x8df9,  0x8ef4,  0x8fef,  0x90e8,  0x91e1,  0x92da,  0x93d2,  0x94c9,
+	 0x95c0,  0x96b5,  0x97ab,  0x989f,  0x9993,  0x9a87,  0x9b79,  0x9c6c,
+	 0x9d5d,  0x9e4e,  0x9f3e,  0xa02e,  0xa11d,  0xa20b,  0xa2f9,  0xa3e6,
+	 0xa4d3,  0xa5bf,  0xa6ab,  0xa796,  0xa880,  0xa96a,  0xaa53,  0xab3b,
+	 0xac23,  0xad0b,  0xadf2,  0xaed8,  0xafbe,  0xb0a3,  0xb188,  0xb26c,
+	 0xb34f,  0xb432,  0xb515,  0xb5f7,  0xb6d8,  0xb7b9,  0xb899,  0xb979,
+	 0xba58,  0xbb37,  0xbc15,  0xbcf3,  0xbdd0,  0xbead,  0xbf89,  0xc064,
+	 0xc140,  0xc21a,  0xc2f4,  0xc3ce,  0xc4a7,  0xc580,  0xc658,  0xc72f,
+	 0xc806,  0xc8dd,  0xc9b3,  0xca89,  0xcb5e,  0xcc33,  0xcd07,  0xcddb,
+	 0xceae,  0xcf81,  0xd053,  0xd125,  0xd1f6,  0xd2c7,  0xd398,  0xd468,
+	 0xd537,  0xd607,  0xd6d5,  0xd7a3,  0xd871,  0xd93f,  0xda0b,  0xdad8,
+	 0xdba4,  0xdc6f,  0xdd3a,  0xde05,  0xdecf,  0xdf99,  0xe063,  0xe12b,
+	 0xe1f4,  0xe2bc,  0xe384,  0xe44b,  0xe512,  0xe5d8,  0xe69e,  0xe764,
+	 0xe829,  0xe8ee,  0xe9b2,  0xea76,  0xeb3a,  0xebfd,  0xecc0,  0xed82,
+	 0xee44,  0xef05,  0xefc7,  0xf087,  0xf148,  0xf208,  0xf2c7,  0xf386,
+	 0xf445,  0xf504,  0xf5c2,  0xf67f,  0xf73d,  0xf7fa,  0xf8b6,  0xf972,
+	 0xfa2e,  0xfae9,  0xfba4,  0xfc5f,  0xfd19,  0xfdd3,  0xfe8d,  0xff46
+};
+#endif
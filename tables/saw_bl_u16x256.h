@@ -0,0 +1,261 @@
+#ifndef SAW_BL_U16X256_H
+#define SAW_BL_U16X256_H
+const uint16_t saw_bl_u16x256[] PROGMEM = {
+	 0x8000,  0xffff,  0xe0f7,  0xf1f5,  0xe468,  0xed69,  0xe481,  0xea75,
+	 0xe3b5,  0xe80d,  0xe28d,  0xe5e5,  0xe137,  0xe3e1,  0xdfc5,  0xe1f1,
+	 0xde43,  0xe00f,  0xdcb6,  0xde36,  0xdb21,  0xdc64,  0xd986,  0xda97,
+	 0xd7e7,  0xd8cd,  0xd645,  0xd707,  0xd49f,  0xd542,  0xd2f8,  0xd380,
+	 0xd150,  0xd1bf,  0xcfa5,  0xd000,  0xcdfa,  0xce41,  0xcc4e,  0xcc84,
+	 0xcaa1,  0xcac7,  0xc8f3,  0xc90a,  0xc744,  0xc74f,  0xc596,  0xc594,
+	 0xc3e6,  0xc3d9,  0xc236,  0xc21f,  0xc086,  0xc065,  0xbed6,  0xbeab,
+	 0xbd25,  0xbcf2,  0xbb74,  0xbb38,  0xb9c2,  0xb980,  0xb811,  0xb7c7,
+	 0xb65f,  0xb60e,  0xb4ad,  0xb456,  0xb2fb,  0xb29d,  0xb149,  0xb0e5,
+	 0xaf97,  0xaf2d,  0xade5,  0xad75,  0xac32,  0xabbe,  0xaa80,  0xaa06,
+	 0xa8cd,  0xa84e,  0xa71a,  0xa697,  0xa567,  0xa4df,  0xa3b5,  0xa328,
+	 0xa202,  0xa170,  0xa04f,  0x9fb9,  0x9e9c,  0x9e02,  0x9ce9,  0x9c4b,
+	 0x9b35,  0x9a93,  0x9982,  0x98dc,  0x97cf,  0x9725,  0x961c,  0x956e,
+	 0x9468,  0x93b7,  0x92b5,  0x9200,  0x9102,  0x9049,  0x8f4e,  0x8e92,
+	 0x8d9b,  0x8cdb,  0x8be8,  0x8b24,  0x8a34,  0x896d,  0x8881,  0x87b6,
+	 0x86cd,  0x8600,  0x851a,  0x8449,  0x8366,  0x8292,  0x81b3,  0x80db,
+	 0x7fff,  0x7f24,  0x7e4c,  0x7d6d,  0x7c99,  0x7bb6,  0x7ae5,  0x79ff,
+	 0x7932,  0x7849,  0x777e,  0x7692,  0x75cb,  0x74db,  0x7417,  0x7324,
+	 0x7264,  0x716d,  0x70b1,  0x6fb6,  0x6efd,  0x6dff,  0x6d4a,  0x6c48,
+	 0x6b97,  0x6a91,  0x69e3,  0x68da,  0x6830,  0x6723,  0x667d,  0x656c,
+	 0x64ca,  0x63b4,  0x6316,  0x61fd,  0x6163,  0x6046,  0x5fb0,  0x5e8f,
+	 0x5dfd,  0x5cd7,  0x5c4a,  0x5b20,  0x5a98,  0x5968,  0x58e5,  0x57b1,
+	 0x5732,  0x55f9,  0x557f,  0x5441,  0x53cd,  0x528a,  0x521a,  0x50d2,
+	 0x5068,  0x4f1a,  0x4eb6,  0x4d62,  0x4d04,  0x4ba9,  0x4b52,  0x49f1,
+	 0x49a0,  0x4838,  0x47ee,  0x467f,  0x463d,  0x44c7,  0x448b,  0x430d,
+	 0x42da,  0x4154,  0x4129,  0x3f9a,  0x3f79,  0x3de0,  0x3dc9,  0x3c26,
+	 0x3c19,  0x3a6b,  0x3a69,  0x38b0,  0x38bb,  0x36f5,  0x370c,  0x3538,
+	 0x355e,  0x337b,  0x33b1,  0x31be,  0x3205,  0x2fff,  0x305a,  0x2e40,
+	 0x2eaf,  0x2c7f,  0x2d07,  0x2abd,  0x2b60,  0x28f8,  0x29ba,  0x2732,
+	 0x2818,  0x2568,  0x2679,  0x239b,  0x24de,  0x21c9,  0x2349,  0x1ff0,
+	 0x21bc,  0x1e0e,  0x203a,  0x1c1e,  0x1ec8,  0x1a1a,  0x1d72,  0x17f2,
+	 0x1c4a,  0x158a,  0x1b7e,  0x1296,  0x1b97,  0x0e0a,  0x1f08,  0x0000,
+	 0x8000,  0xdf0f,  0xff24,  0xeccd,  0xdf43,  0xe886,  0xef63,  0xe752,
+	 0xe101,  0xe5cf,  0xe920,  0xe396,  0xdf66,  0xe291,  0xe475,  0xe010,
+	 0xdce8,  0xdf38,  0xe056,  0xdc9a,  0xda0c,  0xdbd6,  0xdc77,  0xd92a,
+	 0xd702,  0xd871,  0xd8bc,  0xd5bc,  0xd3dd,  0xd50a,  0xd515,  0xd24f,
+	 0xd0a8,  0xd1a1,  0xd17c,  0xcee3,  0xcd67,  0xce38,  0xcdec,  0xcb77,
+	 0xca1f,  0xcacf,  0xca63,  0xc80c,  0xc6d0,  0xc765,  0xc6df,  0xc4a1,
+	 0xc37e,  0xc3fb,  0xc35f,  0xc136,  0xc028,  0xc091,  0xbfe1,  0xbdcc,
+	 0xbcd0,  0xbd27,  0xbc66,  0xba61,  0xb976,  0xb9bd,  0xb8ec,  0xb6f7,
+	 0xb61a,  0xb653,  0xb574,  0xb38c,  0xb2bc,  0xb2e9,  0xb1fd,  0xb021,
+	 0xaf5e,  0xaf7f,  0xae88,  0xacb7,  0xabff,  0xac15,  0xab13,  0xa94d,
+	 0xa89f,  0xa8ab,  0xa79e,  0xa5e2,  0xa53e,  0xa540,  0xa42b,  0xa278,
+	 0xa1dc,  0xa1d6,  0xa0b8,  0x9f0d,  0x9e7b,  0x9e6c,  0x9d45,  0x9ba3,
+	 0x9b19,  0x9b01,  0x99d3,  0x9839,  0x97b6,  0x9797,  0x9661,  0x94ce,
+	 0x9453,  0x942d,  0x92ef,  0x9164,  0x90f0,  0x90c3,  0x8f7d,  0x8df9,
+	 0x8d8d,  0x8d58,  0x8c0c,  0x8a8f,  0x8a2a,  0x89ee,  0x889b,  0x8725,
+	 0x86c6,  0x8684,  0x8529,  0x83ba,  0x8363,  0x8319,  0x81b8,  0x8050,
+	 0x7fff,  0x7faf,  0x7e47,  0x7ce6,  0x7c9c,  0x7c45,  0x7ad6,  0x797b,
+	 0x7939,  0x78da,  0x7764,  0x7611,  0x75d5,  0x7570,  0x73f3,  0x72a7,
+	 0x7272,  0x7206,  0x7082,  0x6f3c,  0x6f0f,  0x6e9b,  0x6d10,  0x6bd2,
+	 0x6bac,  0x6b31,  0x699e,  0x6868,  0x6849,  0x67c6,  0x662c,  0x64fe,
+	 0x64e6,  0x645c,  0x62ba,  0x6193,  0x6184,  0x60f2,  0x5f47,  0x5e29,
+	 0x5e23,  0x5d87,  0x5bd4,  0x5abf,  0x5ac1,  0x5a1d,  0x5861,  0x5754,
+	 0x5760,  0x56b2,  0x54ec,  0x53ea,  0x5400,  0x5348,  0x5177,  0x5080,
+	 0x50a1,  0x4fde,  0x4e02,  0x4d16,  0x4d43,  0x4c73,  0x4a8b,  0x49ac,
+	 0x49e5,  0x4908,  0x4713,  0x4642,  0x4689,  0x459e,  0x4399,  0x42d8,
+	 0x432f,  0x4233,  0x401e,  0x3f6e,  0x3fd7,  0x3ec9,  0x3ca0,  0x3c04,
+	 0x3c81,  0x3b5e,  0x3920,  0x389a,  0x392f,  0x37f3,  0x359c,  0x3530,
+	 0x35e0,  0x3488,  0x3213,  0x31c7,  0x3298,  0x311c,  0x2e83,  0x2e5e,
+	 0x2f57,  0x2db0,  0x2aea,  0x2af5,  0x2c22,  0x2a43,  0x2743,  0x278e,
+	 0x28fd,  0x26d5,  0x2388,  0x2429,  0x25f3,  0x2365,  0x1fa9,  0x20c7,
+	 0x2317,  0x1fef,  0x1b8a,  0x1d6e,  0x2099,  0x1c69,  0x16df,  0x1a30,
+	 0x1efe,  0x18ad,  0x109c,  0x1779,  0x20bc,  0x1332,  0x00db,  0x20f0,
+	 0x8000,  0xb4b8,  0xdebf,  0xf73d,  0xfd6b,  0xf638,  0xe9b3,  0xdf7d,
+	 0xdbe0,  0xdec7,  0xe4cb,  0xe993,  0xea39,  0xe691,  0xe0ce,  0xdbfc,
+	 0xda3b,  0xdbae,  0xdeaa,  0xe0d3,  0xe085,  0xddab,  0xd9a7,  0xd666,
+	 0xd53c,  0xd62b,  0xd802,  0xd91e,  0xd868,  0xd5eb,  0xd2b8,  0xd039,
+	 0xcf5a,  0xd004,  0xd13e,  0xd1c7,  0xd0d8,  0xce90,  0xcbd7,  0xc9cd,
+	 0xc91b,  0xc99b,  0xca72,  0xca9d,  0xc988,  0xc763,  0xc4fc,  0xc340,
+	 0xc2ae,  0xc310,  0xc3a2,  0xc38a,  0xc25b,  0xc04f,  0xbe24,  0xbca2,
+	 0xbc27,  0xbc73,  0xbcd1,  0xbc86,  0xbb42,  0xb94a,  0xb74d,  0xb5f7,
+	 0xb58f,  0xb5c9,  0xb5fe,  0xb58b,  0xb437,  0xb24e,  0xb077,  0xaf46,
+	 0xaeec,  0xaf18,  0xaf2a,  0xae96,  0xad34,  0xab59,  0xa9a1,  0xa88f,
+	 0xa842,  0xa861,  0xa857,  0xa7a6,  0xa638,  0xa469,  0xa2cb,  0xa1d4,
+	 0xa192,  0xa1a7,  0xa183,  0xa0b8,  0x9f40,  0x9d7b,  0x9bf6,  0x9b17,
+	 0x9adf,  0x9aea,  0x9aae,  0x99cd,  0x984b,  0x9690,  0x9521,  0x9458,
+	 0x9429,  0x942b,  0x93da,  0x92e3,  0x9159,  0x8fa6,  0x8e4c,  0x8d98,
+	 0x8d72,  0x8d6b,  0x8d06,  0x8bfa,  0x8a68,  0x88bd,  0x8777,  0x86d7,
+	 0x86b9,  0x86aa,  0x8631,  0x8512,  0x8378,  0x81d5,  0x80a3,  0x8016,
+	 0x8000,  0x7fe9,  0x7f5c,  0x7e2a,  0x7c87,  0x7aed,  0x79ce,  0x7955,
+	 0x7946,  0x7928,  0x7888,  0x7742,  0x7597,  0x7405,  0x72f9,  0x7294,
+	 0x728d,  0x7267,  0x71b3,  0x7059,  0x6ea6,  0x6d1c,  0x6c25,  0x6bd4,
+	 0x6bd6,  0x6ba7,  0x6ade,  0x696f,  0x67b4,  0x6632,  0x6551,  0x6515,
+	 0x6520,  0x64e8,  0x6409,  0x6284,  0x60bf,  0x5f47,  0x5e7c,  0x5e58,
+	 0x5e6d,  0x5e2b,  0x5d34,  0x5b96,  0x59c7,  0x5859,  0x57a8,  0x579e,
+	 0x57bd,  0x5770,  0x565e,  0x54a6,  0x52cb,  0x5169,  0x50d5,  0x50e7,
+	 0x5113,  0x50b9,  0x4f88,  0x4db1,  0x4bc8,  0x4a74,  0x4a01,  0x4a36,
+	 0x4a70,  0x4a08,  0x48b2,  0x46b5,  0x44bd,  0x4379,  0x432e,  0x438c,
+	 0x43d8,  0x435d,  0x41db,  0x3fb0,  0x3da4,  0x3c75,  0x3c5d,  0x3cef,
+	 0x3d51,  0x3cbf,  0x3b03,  0x389c,  0x3677,  0x3562,  0x358d,  0x3664,
+	 0x36e4,  0x3632,  0x3428,  0x316f,  0x2f27,  0x2e38,  0x2ec1,  0x2ffb,
+	 0x30a5,  0x2fc6,  0x2d47,  0x2a14,  0x2797,  0x26e1,  0x27fd,  0x29d4,
+	 0x2ac3,  0x2999,  0x2658,  0x2254,  0x1f7a,  0x1f2c,  0x2155,  0x2451,
+	 0x25c4,  0x2403,  0x1f31,  0x196e,  0x15c6,  0x166c,  0x1b34,  0x2138,
+	 0x241f,  0x2082,  0x164c,  0x09c7,  0x0294,  0x08c2,  0x2140,  0x4b47,
+	 0x8000,  0x9b11,  0xb4a2,  0xcb57,  0xde1c,  0xec3a,  0xf568,  0xf9cd,
+	 0xf9f3,  0xf6b6,  0xf125,  0xea62,  0xe382,  0xdd6e,  0xd8d2,  0xd60b,
+	 0xd527,  0xd5ed,  0xd7ef,  0xda9a,  0xdd53,  0xdf8b,  0xe0d5,  0xe0f1,
+	 0xdfd1,  0xdd9a,  0xda96,  0xd72c,  0xd3c8,  0xd0d0,  0xce91,  0xcd37,
+	 0xccc9,  0xcd27,  0xce15,  0xcf44,  0xd05d,  0xd114,  0xd12d,  0xd08a,
+	 0xcf2b,  0xcd2e,  0xcac7,  0xc83a,  0xc5cd,  0xc3be,  0xc23b,  0xc158,
+	 0xc112,  0xc14b,  0xc1d2,  0xc26d,  0xc2e0,  0xc2f7,  0xc28e,  0xc198,
+	 0xc01d,  0xbe3a,  0xbc1e,  0xb9fc,  0xb809,  0xb670,  0xb54e,  0xb4ab,
+	 0xb47a,  0xb49e,  0xb4ed,  0xb534,  0xb548,  0xb501,  0xb44c,  0xb324,
+	 0xb198,  0xafc6,  0xadd7,  0xabf9,  0xaa54,  0xa908,  0xa825,  0xa7ab,
+	 0xa789,  0xa79f,  0xa7c6,  0xa7d5,  0xa7a6,  0xa71f,  0xa634,  0xa4e8,
+	 0xa350,  0xa18a,  0x9fbd,  0x9e10,  0x9ca5,  0x9b92,  0x9ade,  0x9a84,
+	 0x9a6c,  0x9a78,  0x9a81,  0x9a63,  0x9a01,  0x9947,  0x9830,  0x96c8,
+	 0x9526,  0x936a,  0x91b9,  0x9035,  0x8ef9,  0x8e15,  0x8d89,  0x8d49,
+	 0x8d3a,  0x8d3d,  0x8d2c,  0x8ce9,  0x8c59,  0x8b73,  0x8a37,  0x88b6,
+	 0x870b,  0x8557,  0x83bf,  0x825f,  0x814f,  0x8095,  0x802e,  0x8005,
+	 0x8000,  0x7ffa,  0x7fd1,  0x7f6a,  0x7eb0,  0x7da0,  0x7c40,  0x7aa8,
+	 0x78f4,  0x7749,  0x75c8,  0x748c,  0x73a6,  0x7316,  0x72d3,  0x72c2,
+	 0x72c5,  0x72b6,  0x7276,  0x71ea,  0x7106,  0x6fca,  0x6e46,  0x6c95,
+	 0x6ad9,  0x6937,  0x67cf,  0x66b8,  0x65fe,  0x659c,  0x657e,  0x6587,
+	 0x6593,  0x657b,  0x6521,  0x646d,  0x635a,  0x61ef,  0x6042,  0x5e75,
+	 0x5caf,  0x5b17,  0x59cb,  0x58e0,  0x5859,  0x582a,  0x5839,  0x5860,
+	 0x5876,  0x5854,  0x57da,  0x56f7,  0x55ab,  0x5406,  0x5228,  0x5039,
+	 0x4e67,  0x4cdb,  0x4bb3,  0x4afe,  0x4ab7,  0x4acb,  0x4b12,  0x4b61,
+	 0x4b85,  0x4b54,  0x4ab1,  0x498f,  0x47f6,  0x4603,  0x43e1,  0x41c5,
+	 0x3fe2,  0x3e67,  0x3d71,  0x3d08,  0x3d1f,  0x3d92,  0x3e2d,  0x3eb4,
+	 0x3eed,  0x3ea7,  0x3dc4,  0x3c41,  0x3a32,  0x37c5,  0x3538,  0x32d1,
+	 0x30d4,  0x2f75,  0x2ed2,  0x2eeb,  0x2fa2,  0x30bb,  0x31ea,  0x32d8,
+	 0x3336,  0x32c8,  0x316e,  0x2f2f,  0x2c37,  0x28d3,  0x2569,  0x2265,
+	 0x202e,  0x1f0e,  0x1f2a,  0x2074,  0x22ac,  0x2565,  0x2810,  0x2a12,
+	 0x2ad8,  0x29f4,  0x272d,  0x2291,  0x1c7d,  0x159d,  0x0eda,  0x0949,
+	 0x060c,  0x0632,  0x0a97,  0x13c5,  0x21e3,  0x34a8,  0x4b5d,  0x64ee,
+	 0x8000,  0x8da0,  0x9b0b,  0xa80d,  0xb474,  0xc013,  0xcac1,  0xd45e,
+	 0xdccd,  0xe3fa,  0xe9da,  0xee68,  0xf1a9,  0xf3a7,  0xf475,  0xf42b,
+	 0xf2e8,  0xf0cd,  0xee00,  0xeaa8,  0xe6ee,  0xe2f9,  0xdeef,  0xdaf4,
+	 0xd728,  0xd3a6,  0xd085,  0xcdd6,  0xcba5,  0xc9f7,  0xc8cd,  0xc822,
+	 0xc7ec,  0xc81d,  0xc8a4,  0xc96e,  0xca65,  0xcb74,  0xcc85,  0xcd82,
+	 0xce59,  0xcefa,  0xcf56,  0xcf63,  0xcf1c,  0xce7d,  0xcd86,  0xcc3e,
+	 0xcaab,  0xc8d7,  0xc6d1,  0xc4a6,  0xc266,  0xc020,  0xbde5,  0xbbc3,
+	 0xb9c7,  0xb7fc,  0xb66c,  0xb51c,  0xb40f,  0xb346,  0xb2bf,  0xb273,
+	 0xb25c,  0xb270,  0xb2a3,  0xb2e9,  0xb336,  0xb37d,  0xb3b2,  0xb3c8,
+	 0xb3b8,  0xb378,  0xb303,  0xb256,  0xb16f,  0xb051,  0xaf00,  0xad81,
+	 0xabdb,  0xaa1a,  0xa846,  0xa66a,  0xa493,  0xa2ca,  0xa11a,  0x9f8c,
+	 0x9e26,  0x9cee,  0x9be8,  0x9b15,  0x9a74,  0x9a02,  0x99b9,  0x9994,
+	 0x9989,  0x9990,  0x999f,  0x99ac,  0x99ad,  0x9998,  0x9965,  0x990d,
+	 0x988c,  0x97dc,  0x96fd,  0x95f0,  0x94b6,  0x9355,  0x91d1,  0x9034,
+	 0x8e85,  0x8ccd,  0x8b16,  0x896a,  0x87d1,  0x8654,  0x84fa,  0x83c7,
+	 0x82c1,  0x81e7,  0x813b,  0x80bb,  0x8061,  0x8029,  0x800c,  0x8001,
+	 0x8000,  0x7ffe,  0x7ff3,  0x7fd6,  0x7f9e,  0x7f44,  0x7ec4,  0x7e18,
+	 0x7d3e,  0x7c38,  0x7b05,  0x79ab,  0x782e,  0x7695,  0x74e9,  0x7332,
+	 0x717a,  0x6fcb,  0x6e2e,  0x6caa,  0x6b49,  0x6a0f,  0x6902,  0x6823,
+	 0x6773,  0x66f2,  0x669a,  0x6667,  0x6652,  0x6653,  0x6660,  0x666f,
+	 0x6676,  0x666b,  0x6646,  0x65fd,  0x658b,  0x64ea,  0x6417,  0x6311,
+	 0x61d9,  0x6073,  0x5ee5,  0x5d35,  0x5b6c,  0x5995,  0x57b9,  0x55e5,
+	 0x5424,  0x527e,  0x50ff,  0x4fae,  0x4e90,  0x4da9,  0x4cfc,  0x4c87,
+	 0x4c47,  0x4c37,  0x4c4d,  0x4c82,  0x4cc9,  0x4d16,  0x4d5c,  0x4d8f,
+	 0x4da3,  0x4d8c,  0x4d40,  0x4cb9,  0x4bf0,  0x4ae3,  0x4993,  0x4803,
+	 0x4638,  0x443c,  0x421a,  0x3fdf,  0x3d99,  0x3b59,  0x392e,  0x3728,
+	 0x3554,  0x33c1,  0x3279,  0x3182,  0x30e3,  0x309c,  0x30a9,  0x3105,
+	 0x31a6,  0x327d,  0x337a,  0x348b,  0x359a,  0x3691,  0x375b,  0x37e2,
+	 0x3813,  0x37dd,  0x3732,  0x3608,  0x345a,  0x3229,  0x2f7a,  0x2c59,
+	 0x28d7,  0x250b,  0x2110,  0x1d06,  0x1911,  0x1557,  0x11ff,  0x0f32,
+	 0x0d17,  0x0bd4,  0x0b8a,  0x0c58,  0x0e56,  0x1197,  0x1625,  0x1c05,
+	 0x2332,  0x2ba1,  0x353e,  0x3fec,  0x4b8b,  0x57f2,  0x64f4,  0x725f,
+	 0x8000,  0x86d3,  0x8d9e,  0x945a,  0x9afe,  0xa184,  0xa7e3,  0xae14,
+	 0xb412,  0xb9d5,  0xbf57,  0xc494,  0xc985,  0xce27,  0xd276,  0xd66e,
+	 0xda0b,  0xdd4e,  0xe032,  0xe2b8,  0xe4e0,  0xe6a8,  0xe814,  0xe922,
+	 0xe9d7,  0xea34,  0xea3d,  0xe9f4,  0xe95e,  0xe880,  0xe75e,  0xe5fd,
+	 0xe463,  0xe294,  0xe098,  0xde74,  0xdc2e,  0xd9cb,  0xd753,  0xd4ca,
+	 0xd237,  0xcf9f,  0xcd08,  0xca77,  0xc7f1,  0xc57a,  0xc318,  0xc0cc,
+	 0xbe9c,  0xbc8a,  0xba98,  0xb8ca,  0xb720,  0xb59c,  0xb43e,  0xb307,
+	 0xb1f8,  0xb10f,  0xb04b,  0xafab,  0xaf2d,  0xaed0,  0xae91,  0xae6d,
+	 0xae62,  0xae6c,  0xae89,  0xaeb4,  0xaeeb,  0xaf29,  0xaf6c,  0xafb0,
+	 0xaff1,  0xb02c,  0xb05f,  0xb085,  0xb09c,  0xb0a2,  0xb093,  0xb06f,
+	 0xb033,  0xafdd,  0xaf6e,  0xaee2,  0xae3b,  0xad78,  0xac99,  0xab9e,
+	 0xaa89,  0xa959,  0xa812,  0xa6b4,  0xa540,  0xa3ba,  0xa224,  0xa07f,
+	 0x9ecf,  0x9d16,  0x9b56,  0x9994,  0x97d1,  0x9610,  0x9454,  0x92a0,
+	 0x90f6,  0x8f58,  0x8dca,  0x8c4c,  0x8ae2,  0x898b,  0x884b,  0x8721,
+	 0x860f,  0x8515,  0x8433,  0x836b,  0x82ba,  0x8220,  0x819e,  0x8131,
+	 0x80d8,  0x8092,  0x805c,  0x8036,  0x801b,  0x800b,  0x8003,  0x8000,
+	 0x8000,  0x7fff,  0x7ffc,  0x7ff4,  0x7fe4,  0x7fc9,  0x7fa3,  0x7f6d,
+	 0x7f27,  0x7ece,  0x7e61,  0x7ddf,  0x7d45,  0x7c94,  0x7bcc,  0x7aea,
+	 0x79f0,  0x78de,  0x77b4,  0x7674,  0x751d,  0x73b3,  0x7235,  0x70a7,
+	 0x6f09,  0x6d5f,  0x6bab,  0x69ef,  0x682e,  0x666b,  0x64a9,  0x62e9,
+	 0x6130,  0x5f80,  0x5ddb,  0x5c45,  0x5abf,  0x594b,  0x57ed,  0x56a6,
+	 0x5576,  0x5461,  0x5366,  0x5287,  0x51c4,  0x511d,  0x5091,  0x5022,
+	 0x4fcc,  0x4f90,  0x4f6c,  0x4f5d,  0x4f63,  0x4f7a,  0x4fa0,  0x4fd3,
+	 0x500e,  0x504f,  0x5093,  0x50d6,  0x5114,  0x514b,  0x5176,  0x5193,
+	 0x519d,  0x5192,  0x516e,  0x512f,  0x50d2,  0x5054,  0x4fb4,  0x4ef0,
+	 0x4e07,  0x4cf8,  0x4bc1,  0x4a63,  0x48df,  0x4735,  0x4567,  0x4375,
+	 0x4163,  0x3f33,  0x3ce7,  0x3a85,  0x380e,  0x3588,  0x32f7,  0x3060,
+	 0x2dc8,  0x2b35,  0x28ac,  0x2634,  0x23d1,  0x218b,  0x1f67,  0x1d6b,
+	 0x1b9c,  0x1a02,  0x18a1,  0x177f,  0x16a1,  0x160b,  0x15c2,  0x15cb,
+	 0x1628,  0x16dd,  0x17eb,  0x1957,  0x1b1f,  0x1d47,  0x1fcd,  0x22b1,
+	 0x25f4,  0x2991,  0x2d89,  0x31d8,  0x367a,  0x3b6b,  0x40a8,  0x462a,
+	 0x4bed,  0x51eb,  0x581c,  0x5e7b,  0x6501,  0x6ba5,  0x7261,  0x792c,
+	 0x8000,  0x836a,  0x86d2,  0x8a39,  0x8d9b,  0x90f8,  0x944e,  0x979d,
+	 0x9ae3,  0x9e1e,  0xa14e,  0xa471,  0xa786,  0xaa8c,  0xad82,  0xb067,
+	 0xb339,  0xb5f8,  0xb8a3,  0xbb39,  0xbdb9,  0xc022,  0xc273,  0xc4ac,
+	 0xc6cb,  0xc8d1,  0xcabc,  0xcc8d,  0xce42,  0xcfdb,  0xd158,  0xd2b9,
+	 0xd3fc,  0xd523,  0xd62c,  0xd718,  0xd7e7,  0xd898,  0xd92d,  0xd9a3,
+	 0xd9fd,  0xda3b,  0xda5c,  0xda60,  0xda49,  0xda17,  0xd9ca,  0xd962,
+	 0xd8e1,  0xd847,  0xd794,  0xd6ca,  0xd5e8,  0xd4f1,  0xd3e4,  0xd2c2,
+	 0xd18d,  0xd045,  0xceec,  0xcd81,  0xcc07,  0xca7e,  0xc8e7,  0xc743,
+	 0xc593,  0xc3d9,  0xc215,  0xc048,  0xbe74,  0xbc99,  0xbab9,  0xb8d5,
+	 0xb6ed,  0xb503,  0xb317,  0xb12c,  0xaf40,  0xad57,  0xab70,  0xa98d,
+	 0xa7ae,  0xa5d4,  0xa401,  0xa234,  0xa06f,  0x9eb2,  0x9cff,  0x9b55,
+	 0x99b5,  0x9821,  0x9698,  0x951a,  0x93a9,  0x9245,  0x90ee,  0x8fa4,
+	 0x8e68,  0x8d3a,  0x8c1a,  0x8b08,  0x8a04,  0x890f,  0x8828,  0x874e,
+	 0x8683,  0x85c6,  0x8516,  0x8474,  0x83df,  0x8357,  0x82db,  0x826b,
+	 0x8206,  0x81ad,  0x815e,  0x8119,  0x80de,  0x80ac,  0x8081,  0x805e,
+	 0x8042,  0x802c,  0x801c,  0x8010,  0x8008,  0x8003,  0x8001,  0x8000,
+	 0x8000,  0x7fff,  0x7ffe,  0x7ffc,  0x7ff7,  0x7fef,  0x7fe3,  0x7fd3,
+	 0x7fbd,  0x7fa1,  0x7f7e,  0x7f53,  0x7f21,  0x7ee6,  0x7ea1,  0x7e52,
+	 0x7df9,  0x7d94,  0x7d24,  0x7ca8,  0x7c20,  0x7b8b,  0x7ae9,  0x7a39,
+	 0x797c,  0x78b1,  0x77d7,  0x76f0,  0x75fb,  0x74f7,  0x73e5,  0x72c5,
+	 0x7197,  0x705b,  0x6f11,  0x6dba,  0x6c56,  0x6ae5,  0x6967,  0x67de,
+	 0x664a,  0x64aa,  0x6300,  0x614d,  0x5f90,  0x5dcb,  0x5bfe,  0x5a2b,
+	 0x5851,  0x5672,  0x548f,  0x52a8,  0x50bf,  0x4ed3,  0x4ce8,  0x4afc,
+	 0x4912,  0x472a,  0x4546,  0x4366,  0x418b,  0x3fb7,  0x3dea,  0x3c26,
+	 0x3a6c,  0x38bc,  0x3718,  0x3581,  0x33f8,  0x327e,  0x3113,  0x2fba,
+	 0x2e72,  0x2d3d,  0x2c1b,  0x2b0e,  0x2a17,  0x2935,  0x286b,  0x27b8,
+	 0x271e,  0x269d,  0x2635,  0x25e8,  0x25b6,  0x259f,  0x25a3,  0x25c4,
+	 0x2602,  0x265c,  0x26d2,  0x2767,  0x2818,  0x28e7,  0x29d3,  0x2adc,
+	 0x2c03,  0x2d46,  0x2ea7,  0x3024,  0x31bd,  0x3372,  0x3543,  0x372e,
+	 0x3934,  0x3b53,  0x3d8c,  0x3fdd,  0x4246,  0x44c6,  0x475c,  0x4a07,
+	 0x4cc6,  0x4f98,  0x527d,  0x5573,  0x5879,  0x5b8e,  0x5eb1,  0x61e1,
+	 0x651c,  0x6862,  0x6bb1,  0x6f07,  0x7264,  0x75c6,  0x792d,  0x7c95,
+	 0x8000,  0x81b5,  0x8369,  0x851e,  0x86d1,  0x8884,  0x8a35,  0x8be5,
+	 0x8d92,  0x8f3e,  0x90e7,  0x928e,  0x9432,  0x95d3,  0x9770,  0x990a,
+	 0x9aa0,  0x9c32,  0x9dbf,  0x9f48,  0xa0cc,  0xa24b,  0xa3c5,  0xa539,
+	 0xa6a7,  0xa810,  0xa972,  0xaace,  0xac23,  0xad72,  0xaeb9,  0xaff9,
+	 0xb132,  0xb264,  0xb38d,  0xb4af,  0xb5c8,  0xb6d9,  0xb7e2,  0xb8e2,
+	 0xb9d9,  0xbac8,  0xbbad,  0xbc89,  0xbd5c,  0xbe25,  0xbee5,  0xbf9b,
+	 0xc047,  0xc0ea,  0xc182,  0xc210,  0xc294,  0xc30e,  0xc37e,  0xc3e3,
+	 0xc43d,  0xc48d,  0xc4d3,  0xc50d,  0xc53e,  0xc563,  0xc57e,  0xc58e,
+	 0xc593,  0xc58e,  0xc57e,  0xc563,  0xc53e,  0xc50d,  0xc4d3,  0xc48d,
+	 0xc43d,  0xc3e3,  0xc37e,  0xc30e,  0xc294,  0xc210,  0xc182,  0xc0ea,
+	 0xc047,  0xbf9b,  0xbee5,  0xbe25,  0xbd5c,  0xbc89,  0xbbad,  0xbac8,
+	 0xb9d9,  0xb8e2,  0xb7e2,  0xb6d9,  0xb5c8,  0xb4af,  0xb38d,  0xb264,
+	 0xb132,  0xaff9,  0xaeb9,  0xad72,  0xac23,  0xaace,  0xa972,  0xa810,
+	 0xa6a7,  0xa539,  0xa3c5,  0xa24b,  0xa0cc,  0x9f48,  0x9dbf,  0x9c32,
+	 0x9aa0,  0x990a,  0x9770,  0x95d3,  0x9432,  0x928e,  0x90e7,  0x8f3e,
+	 0x8d92,  0x8be5,  0x8a35,  0x8884,  0x86d1,  0x851e,  0x8369,  0x81b5,
+	 0x8000,  0x7e4a,  0x7c96,  0x7ae1,  0x792e,  0x777b,  0x75ca,  0x741a,
+	 0x726d,  0x70c1,  0x6f18,  0x6d71,  0x6bcd,  0x6a2c,  0x688f,  0x66f5,
+	 0x655f,  0x63cd,  0x6240,  0x60b7,  0x5f33,  0x5db4,  0x5c3a,  0x5ac6,
+	 0x5958,  0x57ef,  0x568d,  0x5531,  0x53dc,  0x528d,  0x5146,  0x5006,
+	 0x4ecd,  0x4d9b,  0x4c72,  0x4b50,  0x4a37,  0x4926,  0x481d,  0x471d,
+	 0x4626,  0x4537,  0x4452,  0x4376,  0x42a3,  0x41da,  0x411a,  0x4064,
+	 0x3fb8,  0x3f15,  0x3e7d,  0x3def,  0x3d6b,  0x3cf1,  0x3c81,  0x3c1c,
+	 0x3bc2,  0x3b72,  0x3b2c,  0x3af2,  0x3ac1,  0x3a9c,  0x3a81,  0x3a71,
+	 0x3a6c,  0x3a71,  0x3a81,  0x3a9c,  0x3ac1,  0x3af2,  0x3b2c,  0x3b72,
+	 0x3bc2,  0x3c1c,  0x3c81,  0x3cf1,  0x3d6b,  0x3def,  0x3e7d,  0x3f15,
+	 0x3fb8,  0x4064,  0x411a,  0x41da,  0x42a3,  0x4376,  0x4452,  0x4537,
+	 0x4626,  0x471d,  0x481d,  0x4926,  0x4a37,  0x4b50,  0x4c72,  0x4d9b,
+	 0x4ecd,  0x5006,  0x5146,  0x528d,  0x53dc,  0x5531,  0x568d,  0x57ef,
+	 0x5958,  0x5ac6,  0x5c3a,  0x5db4,  0x5f33,  0x60b7,  0x6240,  0x63cd,
+	 0x655f,  0x66f5,  0x688f,  0x6a2c,  0x6bcd,  0x6d71,  0x6f18,  0x70c1,
+	 0x726d,  0x741a,  0x75ca,  0x777b,  0x792e,  0x7ae1,  0x7c96,  0x7e4a
+};
+#endif
@@ -0,0 +1,261 @@
+#ifndef SQUARE_BL_U16X256_H
+#define SQUARE_BL_U16X256_H
+const uint16_t square_bl_u16x256[] PROGMEM = {
+	 0x8000,  0xf686,  0xdac1,  0xeb30,  0xdf7d,  0xe895,  0xe123,  0xe771,
+	 0xe1f9,  0xe6ce,  0xe279,  0xe666,  0xe2cf,  0xe61f,  0xe30b,  0xe5ea,
+	 0xe339,  0xe5c3,  0xe35c,  0xe5a4,  0xe378,  0xe58b,  0xe38e,  0xe576,
+	 0xe3a1,  0xe565,  0xe3b0,  0xe557,  0xe3bd,  0xe54b,  0xe3c8,  0xe541,
+	 0xe3d2,  0xe538,  0xe3da,  0xe530,  0xe3e1,  0xe529,  0xe3e8,  0xe524,
+	 0xe3ed,  0xe51f,  0xe3f2,  0xe51a,  0xe3f6,  0xe516,  0xe3f9,  0xe513,
+	 0xe3fd,  0xe510,  0xe3ff,  0xe50e,  0xe401,  0xe50c,  0xe403,  0xe50a,
+	 0xe405,  0xe509,  0xe406,  0xe508,  0xe406,  0xe507,  0xe407,  0xe507,
+	 0xe407,  0xe507,  0xe407,  0xe507,  0xe406,  0xe508,  0xe406,  0xe509,
+	 0xe405,  0xe50a,  0xe403,  0xe50c,  0xe401,  0xe50e,  0xe3ff,  0xe510,
+	 0xe3fd,  0xe513,  0xe3f9,  0xe516,  0xe3f6,  0xe51a,  0xe3f2,  0xe51f,
+	 0xe3ed,  0xe524,  0xe3e8,  0xe529,  0xe3e1,  0xe530,  0xe3da,  0xe538,
+	 0xe3d2,  0xe541,  0xe3c8,  0xe54b,  0xe3bd,  0xe557,  0xe3b0,  0xe565,
+	 0xe3a1,  0xe576,  0xe38e,  0xe58b,  0xe378,  0xe5a4,  0xe35c,  0xe5c3,
+	 0xe339,  0xe5ea,  0xe30b,  0xe61f,  0xe2cf,  0xe666,  0xe279,  0xe6ce,
+	 0xe1f9,  0xe771,  0xe123,  0xe895,  0xdf7d,  0xeb30,  0xdac1,  0xf686,
+	 0x8000,  0x0979,  0x253e,  0x14cf,  0x2082,  0x176a,  0x1edc,  0x188e,
+	 0x1e06,  0x1931,  0x1d86,  0x1999,  0x1d30,  0x19e0,  0x1cf4,  0x1a15,
+	 0x1cc6,  0x1a3c,  0x1ca3,  0x1a5b,  0x1c87,  0x1a74,  0x1c71,  0x1a89,
+	 0x1c5e,  0x1a9a,  0x1c4f,  0x1aa8,  0x1c42,  0x1ab4,  0x1c37,  0x1abe,
+	 0x1c2d,  0x1ac7,  0x1c25,  0x1acf,  0x1c1e,  0x1ad6,  0x1c17,  0x1adb,
+	 0x1c12,  0x1ae0,  0x1c0d,  0x1ae5,  0x1c09,  0x1ae9,  0x1c06,  0x1aec,
+	 0x1c02,  0x1aef,  0x1c00,  0x1af1,  0x1bfe,  0x1af3,  0x1bfc,  0x1af5,
+	 0x1bfa,  0x1af6,  0x1bf9,  0x1af7,  0x1bf9,  0x1af8,  0x1bf8,  0x1af8,
+	 0x1bf8,  0x1af8,  0x1bf8,  0x1af8,  0x1bf9,  0x1af7,  0x1bf9,  0x1af6,
+	 0x1bfa,  0x1af5,  0x1bfc,  0x1af3,  0x1bfe,  0x1af1,  0x1c00,  0x1aef,
+	 0x1c02,  0x1aec,  0x1c06,  0x1ae9,  0x1c09,  0x1ae5,  0x1c0d,  0x1ae0,
+	 0x1c12,  0x1adb,  0x1c17,  0x1ad6,  0x1c1e,  0x1acf,  0x1c25,  0x1ac7,
+	 0x1c2d,  0x1abe,  0x1c37,  0x1ab4,  0x1c42,  0x1aa8,  0x1c4f,  0x1a9a,
+	 0x1c5e,  0x1a89,  0x1c71,  0x1a74,  0x1c87,  0x1a5b,  0x1ca3,  0x1a3c,
+	 0x1cc6,  0x1a15,  0x1cf4,  0x19e0,  0x1d30,  0x1999,  0x1d86,  0x1931,
+	 0x1e06,  0x188e,  0x1edc,  0x176a,  0x2082,  0x14cf,  0x253e,  0x0979,
+	 0x8000,  0xd7ba,  0xf687,  0xe6ee,  0xdabe,  0xe393,  0xeb35,  0xe508,
+	 0xdf76,  0xe438,  0xe89d,  0xe4bc,  0xe11a,  0xe461,  0xe77c,  0xe4a4,
+	 0xe1ec,  0xe471,  0xe6dc,  0xe499,  0xe269,  0xe479,  0xe678,  0xe493,
+	 0xe2bb,  0xe47d,  0xe634,  0xe48f,  0xe2f4,  0xe480,  0xe604,  0xe48d,
+	 0xe31d,  0xe482,  0xe5e0,  0xe48c,  0xe33c,  0xe483,  0xe5c6,  0xe48a,
+	 0xe353,  0xe484,  0xe5b1,  0xe48a,  0xe365,  0xe485,  0xe5a2,  0xe489,
+	 0xe372,  0xe485,  0xe597,  0xe488,  0xe37c,  0xe486,  0xe58f,  0xe488,
+	 0xe382,  0xe486,  0xe58a,  0xe488,  0xe386,  0xe487,  0xe587,  0xe487,
+	 0xe387,  0xe487,  0xe587,  0xe487,  0xe386,  0xe488,  0xe58a,  0xe486,
+	 0xe382,  0xe488,  0xe58f,  0xe486,  0xe37c,  0xe488,  0xe597,  0xe485,
+	 0xe372,  0xe489,  0xe5a2,  0xe485,  0xe365,  0xe48a,  0xe5b1,  0xe484,
+	 0xe353,  0xe48a,  0xe5c6,  0xe483,  0xe33c,  0xe48c,  0xe5e0,  0xe482,
+	 0xe31d,  0xe48d,  0xe604,  0xe480,  0xe2f4,  0xe48f,  0xe634,  0xe47d,
+	 0xe2bb,  0xe493,  0xe678,  0xe479,  0xe269,  0xe499,  0xe6dc,  0xe471,
+	 0xe1ec,  0xe4a4,  0xe77c,  0xe461,  0xe11a,  0xe4bc,  0xe89d,  0xe438,
+	 0xdf76,  0xe508,  0xeb35,  0xe393,  0xdabe,  0xe6ee,  0xf687,  0xd7ba,
+	 0x8000,  0x2845,  0x0978,  0x1911,  0x2541,  0x1c6c,  0x14ca,  0x1af7,
+	 0x2089,  0x1bc7,  0x1762,  0x1b43,  0x1ee5,  0x1b9e,  0x1883,  0x1b5b,
+	 0x1e13,  0x1b8e,  0x1923,  0x1b66,  0x1d96,  0x1b86,  0x1987,  0x1b6c,
+	 0x1d44,  0x1b82,  0x19cb,  0x1b70,  0x1d0b,  0x1b7f,  0x19fb,  0x1b72,
+	 0x1ce2,  0x1b7d,  0x1a1f,  0x1b73,  0x1cc3,  0x1b7c,  0x1a39,  0x1b75,
+	 0x1cac,  0x1b7b,  0x1a4e,  0x1b75,  0x1c9a,  0x1b7a,  0x1a5d,  0x1b76,
+	 0x1c8d,  0x1b7a,  0x1a68,  0x1b77,  0x1c83,  0x1b79,  0x1a70,  0x1b77,
+	 0x1c7d,  0x1b79,  0x1a75,  0x1b77,  0x1c79,  0x1b78,  0x1a78,  0x1b78,
+	 0x1c78,  0x1b78,  0x1a78,  0x1b78,  0x1c79,  0x1b77,  0x1a75,  0x1b79,
+	 0x1c7d,  0x1b77,  0x1a70,  0x1b79,  0x1c83,  0x1b77,  0x1a68,  0x1b7a,
+	 0x1c8d,  0x1b76,  0x1a5d,  0x1b7a,  0x1c9a,  0x1b75,  0x1a4e,  0x1b7b,
+	 0x1cac,  0x1b75,  0x1a39,  0x1b7c,  0x1cc3,  0x1b73,  0x1a1f,  0x1b7d,
+	 0x1ce2,  0x1b72,  0x19fb,  0x1b7f,  0x1d0b,  0x1b70,  0x19cb,  0x1b82,
+	 0x1d44,  0x1b6c,  0x1987,  0x1b86,  0x1d96,  0x1b66,  0x1923,  0x1b8e,
+	 0x1e13,  0x1b5b,  0x1883,  0x1b9e,  0x1ee5,  0x1b43,  0x1762,  0x1bc7,
+	 0x2089,  0x1af7,  0x14ca,  0x1c6c,  0x2541,  0x1911,  0x0978,  0x2845,
+	 0x8000,  0xb093,  0xd7bc,  0xef5d,  0xf68e,  0xf168,  0xe6ec,  0xddf7,
+	 0xdab1,  0xdd79,  0xe395,  0xe926,  0xeb48,  0xe95d,  0xe506,  0xe0f5,
+	 0xdf5d,  0xe0d6,  0xe43a,  0xe775,  0xe8bd,  0xe788,  0xe4ba,  0xe207,
+	 0xe0f2,  0xe1fa,  0xe463,  0xe6ba,  0xe7ab,  0xe6c3,  0xe4a1,  0xe28d,
+	 0xe1b5,  0xe286,  0xe474,  0xe657,  0xe71c,  0xe65c,  0xe496,  0xe2d7,
+	 0xe220,  0xe2d3,  0xe47c,  0xe61f,  0xe6cb,  0xe622,  0xe48f,  0xe301,
+	 0xe25e,  0xe2ff,  0xe481,  0xe600,  0xe69d,  0xe601,  0xe48b,  0xe317,
+	 0xe27e,  0xe316,  0xe485,  0xe5f2,  0xe689,  0xe5f3,  0xe488,  0xe31e,
+	 0xe288,  0xe31e,  0xe488,  0xe5f3,  0xe689,  0xe5f2,  0xe485,  0xe316,
+	 0xe27e,  0xe317,  0xe48b,  0xe601,  0xe69d,  0xe600,  0xe481,  0xe2ff,
+	 0xe25e,  0xe301,  0xe48f,  0xe622,  0xe6cb,  0xe61f,  0xe47c,  0xe2d3,
+	 0xe220,  0xe2d7,  0xe496,  0xe65c,  0xe71c,  0xe657,  0xe474,  0xe286,
+	 0xe1b5,  0xe28d,  0xe4a1,  0xe6c3,  0xe7ab,  0xe6ba,  0xe463,  0xe1fa,
+	 0xe0f2,  0xe207,  0xe4ba,  0xe788,  0xe8bd,  0xe775,  0xe43a,  0xe0d6,
+	 0xdf5d,  0xe0f5,  0xe506,  0xe95d,  0xeb48,  0xe926,  0xe395,  0xdd79,
+	 0xdab1,  0xddf7,  0xe6ec,  0xf168,  0xf68e,  0xef5d,  0xd7bc,  0xb093,
+	 0x8000,  0x4f6c,  0x2843,  0x10a2,  0x0971,  0x0e97,  0x1913,  0x2208,
+	 0x254e,  0x2286,  0x1c6a,  0x16d9,  0x14b7,  0x16a2,  0x1af9,  0x1f0a,
+	 0x20a2,  0x1f29,  0x1bc5,  0x188a,  0x1742,  0x1877,  0x1b45,  0x1df8,
+	 0x1f0d,  0x1e05,  0x1b9c,  0x1945,  0x1854,  0x193c,  0x1b5e,  0x1d72,
+	 0x1e4a,  0x1d79,  0x1b8b,  0x19a8,  0x18e3,  0x19a3,  0x1b69,  0x1d28,
+	 0x1ddf,  0x1d2c,  0x1b83,  0x19e0,  0x1934,  0x19dd,  0x1b70,  0x1cfe,
+	 0x1da1,  0x1d00,  0x1b7e,  0x19ff,  0x1962,  0x19fe,  0x1b74,  0x1ce8,
+	 0x1d81,  0x1ce9,  0x1b7a,  0x1a0d,  0x1976,  0x1a0c,  0x1b77,  0x1ce1,
+	 0x1d77,  0x1ce1,  0x1b77,  0x1a0c,  0x1976,  0x1a0d,  0x1b7a,  0x1ce9,
+	 0x1d81,  0x1ce8,  0x1b74,  0x19fe,  0x1962,  0x19ff,  0x1b7e,  0x1d00,
+	 0x1da1,  0x1cfe,  0x1b70,  0x19dd,  0x1934,  0x19e0,  0x1b83,  0x1d2c,
+	 0x1ddf,  0x1d28,  0x1b69,  0x19a3,  0x18e3,  0x19a8,  0x1b8b,  0x1d79,
+	 0x1e4a,  0x1d72,  0x1b5e,  0x193c,  0x1854,  0x1945,  0x1b9c,  0x1e05,
+	 0x1f0d,  0x1df8,  0x1b45,  0x1877,  0x1742,  0x188a,  0x1bc5,  0x1f29,
+	 0x20a2,  0x1f0a,  0x1af9,  0x16a2,  0x14b7,  0x16d9,  0x1c6a,  0x2286,
+	 0x254e,  0x2208,  0x1913,  0x0e97,  0x0971,  0x10a2,  0x2843,  0x4f6c,
+	 0x8000,  0x98eb,  0xb094,  0xc5d6,  0xd7c4,  0xe5bb,  0xef70,  0xf4f3,
+	 0xf6a7,  0xf535,  0xf179,  0xec63,  0xe6e4,  0xe1d1,  0xddd2,  0xdb52,
+	 0xda7e,  0xdb42,  0xdd56,  0xe04b,  0xe39d,  0xe6ca,  0xe95f,  0xeb07,
+	 0xeb97,  0xeb0e,  0xe994,  0xe76f,  0xe4fc,  0xe29b,  0xe0a5,  0xdf5f,
+	 0xdeef,  0xdf5b,  0xe08a,  0xe245,  0xe445,  0xe63b,  0xe7dd,  0xe8ef,
+	 0xe94e,  0xe8f1,  0xe7ed,  0xe66c,  0xe4ad,  0xe2f3,  0xe182,  0xe08d,
+	 0xe038,  0xe08c,  0xe179,  0xe2d8,  0xe473,  0xe60b,  0xe763,  0xe847,
+	 0xe897,  0xe848,  0xe767,  0xe618,  0xe48d,  0xe304,  0xe1b7,  0xe0d9,
+	 0xe08b,  0xe0d9,  0xe1b7,  0xe304,  0xe48d,  0xe618,  0xe767,  0xe848,
+	 0xe897,  0xe847,  0xe763,  0xe60b,  0xe473,  0xe2d8,  0xe179,  0xe08c,
+	 0xe038,  0xe08d,  0xe182,  0xe2f3,  0xe4ad,  0xe66c,  0xe7ed,  0xe8f1,
+	 0xe94e,  0xe8ef,  0xe7dd,  0xe63b,  0xe445,  0xe245,  0xe08a,  0xdf5b,
+	 0xdeef,  0xdf5f,  0xe0a5,  0xe29b,  0xe4fc,  0xe76f,  0xe994,  0xeb0e,
+	 0xeb97,  0xeb07,  0xe95f,  0xe6ca,  0xe39d,  0xe04b,  0xdd56,  0xdb42,
+	 0xda7e,  0xdb52,  0xddd2,  0xe1d1,  0xe6e4,  0xec63,  0xf179,  0xf535,
+	 0xf6a7,  0xf4f3,  0xef70,  0xe5bb,  0xd7c4,  0xc5d6,  0xb094,  0x98eb,
+	 0x8000,  0x6714,  0x4f6b,  0x3a29,  0x283b,  0x1a44,  0x108f,  0x0b0c,
+	 0x0958,  0x0aca,  0x0e86,  0x139c,  0x191b,  0x1e2e,  0x222d,  0x24ad,
+	 0x2581,  0x24bd,  0x22a9,  0x1fb4,  0x1c62,  0x1935,  0x16a0,  0x14f8,
+	 0x1468,  0x14f1,  0x166b,  0x1890,  0x1b03,  0x1d64,  0x1f5a,  0x20a0,
+	 0x2110,  0x20a4,  0x1f75,  0x1dba,  0x1bba,  0x19c4,  0x1822,  0x1710,
+	 0x16b1,  0x170e,  0x1812,  0x1993,  0x1b52,  0x1d0c,  0x1e7d,  0x1f72,
+	 0x1fc7,  0x1f73,  0x1e86,  0x1d27,  0x1b8c,  0x19f4,  0x189c,  0x17b8,
+	 0x1768,  0x17b7,  0x1898,  0x19e7,  0x1b72,  0x1cfb,  0x1e48,  0x1f26,
+	 0x1f74,  0x1f26,  0x1e48,  0x1cfb,  0x1b72,  0x19e7,  0x1898,  0x17b7,
+	 0x1768,  0x17b8,  0x189c,  0x19f4,  0x1b8c,  0x1d27,  0x1e86,  0x1f73,
+	 0x1fc7,  0x1f72,  0x1e7d,  0x1d0c,  0x1b52,  0x1993,  0x1812,  0x170e,
+	 0x16b1,  0x1710,  0x1822,  0x19c4,  0x1bba,  0x1dba,  0x1f75,  0x20a4,
+	 0x2110,  0x20a0,  0x1f5a,  0x1d64,  0x1b03,  0x1890,  0x166b,  0x14f1,
+	 0x1468,  0x14f8,  0x16a0,  0x1935,  0x1c62,  0x1fb4,  0x22a9,  0x24bd,
+	 0x2581,  0x24ad,  0x222d,  0x1e2e,  0x191b,  0x139c,  0x0e86,  0x0aca,
+	 0x0958,  0x0b0c,  0x108f,  0x1a44,  0x283b,  0x3a29,  0x4f6b,  0x6714,
+	 0x8000,  0x8c8a,  0x98eb,  0xa4fd,  0xb099,  0xbb9c,  0xc5e6,  0xcf5b,
+	 0xd7e5,  0xdf70,  0xe5f1,  0xeb61,  0xefbd,  0xf30a,  0xf551,  0xf6a1,
+	 0xf70c,  0xf6a9,  0xf592,  0xf3e3,  0xf1bb,  0xef37,  0xec78,  0xe99c,
+	 0xe6bf,  0xe3fd,  0xe16d,  0xdf24,  0xdd33,  0xdba7,  0xda89,  0xd9de,
+	 0xd9a5,  0xd9dc,  0xda7b,  0xdb77,  0xdcc4,  0xde51,  0xe00e,  0xe1e8,
+	 0xe3cd,  0xe5a9,  0xe76d,  0xe907,  0xea69,  0xeb88,  0xec5b,  0xecdb,
+	 0xed06,  0xecdb,  0xec5f,  0xeb97,  0xea8c,  0xe949,  0xe7db,  0xe650,
+	 0xe4b7,  0xe321,  0xe19c,  0xe036,  0xdefe,  0xddff,  0xdd41,  0xdccc,
+	 0xdca5,  0xdccc,  0xdd41,  0xddff,  0xdefe,  0xe036,  0xe19c,  0xe321,
+	 0xe4b7,  0xe650,  0xe7db,  0xe949,  0xea8c,  0xeb97,  0xec5f,  0xecdb,
+	 0xed06,  0xecdb,  0xec5b,  0xeb88,  0xea69,  0xe907,  0xe76d,  0xe5a9,
+	 0xe3cd,  0xe1e8,  0xe00e,  0xde51,  0xdcc4,  0xdb77,  0xda7b,  0xd9dc,
+	 0xd9a5,  0xd9de,  0xda89,  0xdba7,  0xdd33,  0xdf24,  0xe16d,  0xe3fd,
+	 0xe6bf,  0xe99c,  0xec78,  0xef37,  0xf1bb,  0xf3e3,  0xf592,  0xf6a9,
+	 0xf70c,  0xf6a1,  0xf551,  0xf30a,  0xefbd,  0xeb61,  0xe5f1,  0xdf70,
+	 0xd7e5,  0xcf5b,  0xc5e6,  0xbb9c,  0xb099,  0xa4fd,  0x98eb,  0x8c8a,
+	 0x8000,  0x7375,  0x6714,  0x5b02,  0x4f66,  0x4463,  0x3a19,  0x30a4,
+	 0x281a,  0x208f,  0x1a0e,  0x149e,  0x1042,  0x0cf5,  0x0aae,  0x095e,
+	 0x08f3,  0x0956,  0x0a6d,  0x0c1c,  0x0e44,  0x10c8,  0x1387,  0x1663,
+	 0x1940,  0x1c02,  0x1e92,  0x20db,  0x22cc,  0x2458,  0x2576,  0x2621,
+	 0x265a,  0x2623,  0x2584,  0x2488,  0x233b,  0x21ae,  0x1ff1,  0x1e17,
+	 0x1c32,  0x1a56,  0x1892,  0x16f8,  0x1596,  0x1477,  0x13a4,  0x1324,
+	 0x12f9,  0x1324,  0x13a0,  0x1468,  0x1573,  0x16b6,  0x1824,  0x19af,
+	 0x1b48,  0x1cde,  0x1e63,  0x1fc9,  0x2101,  0x2200,  0x22be,  0x2333,
+	 0x235a,  0x2333,  0x22be,  0x2200,  0x2101,  0x1fc9,  0x1e63,  0x1cde,
+	 0x1b48,  0x19af,  0x1824,  0x16b6,  0x1573,  0x1468,  0x13a0,  0x1324,
+	 0x12f9,  0x1324,  0x13a4,  0x1477,  0x1596,  0x16f8,  0x1892,  0x1a56,
+	 0x1c32,  0x1e17,  0x1ff1,  0x21ae,  0x233b,  0x2488,  0x2584,  0x2623,
+	 0x265a,  0x2621,  0x2576,  0x2458,  0x22cc,  0x20db,  0x1e92,  0x1c02,
+	 0x1940,  0x1663,  0x1387,  0x10c8,  0x0e44,  0x0c1c,  0x0a6d,  0x0956,
+	 0x08f3,  0x095e,  0x0aae,  0x0cf5,  0x1042,  0x149e,  0x1a0e,  0x208f,
+	 0x281a,  0x30a4,  0x3a19,  0x4463,  0x4f66,  0x5b02,  0x6714,  0x7375,
+	 0x8000,  0x8647,  0x8c8a,  0x92c3,  0x98ee,  0x9f06,  0xa505,  0xaae9,
+	 0xb0ac,  0xb64b,  0xbbc0,  0xc10a,  0xc623,  0xcb08,  0xcfb7,  0xd42d,
+	 0xd866,  0xdc61,  0xe01d,  0xe396,  0xe6cc,  0xe9be,  0xec6b,  0xeed2,
+	 0xf0f5,  0xf2d2,  0xf46b,  0xf5c1,  0xf6d4,  0xf7a6,  0xf83a,  0xf891,
+	 0xf8ad,  0xf892,  0xf841,  0xf7bf,  0xf70e,  0xf632,  0xf52e,  0xf407,
+	 0xf2c0,  0xf15c,  0xefe1,  0xee52,  0xecb3,  0xeb09,  0xe957,  0xe7a2,
+	 0xe5ed,  0xe43c,  0xe294,  0xe0f8,  0xdf6b,  0xddf1,  0xdc8c,  0xdb40,
+	 0xda10,  0xd8fd,  0xd80b,  0xd73a,  0xd68d,  0xd605,  0xd5a3,  0xd568,
+	 0xd554,  0xd568,  0xd5a3,  0xd605,  0xd68d,  0xd73a,  0xd80b,  0xd8fd,
+	 0xda10,  0xdb40,  0xdc8c,  0xddf1,  0xdf6b,  0xe0f8,  0xe294,  0xe43c,
+	 0xe5ed,  0xe7a2,  0xe957,  0xeb09,  0xecb3,  0xee52,  0xefe1,  0xf15c,
+	 0xf2c0,  0xf407,  0xf52e,  0xf632,  0xf70e,  0xf7bf,  0xf841,  0xf892,
+	 0xf8ad,  0xf891,  0xf83a,  0xf7a6,  0xf6d4,  0xf5c1,  0xf46b,  0xf2d2,
+	 0xf0f5,  0xeed2,  0xec6b,  0xe9be,  0xe6cc,  0xe396,  0xe01d,  0xdc61,
+	 0xd866,  0xd42d,  0xcfb7,  0xcb08,  0xc623,  0xc10a,  0xbbc0,  0xb64b,
+	 0xb0ac,  0xaae9,  0xa505,  0x9f06,  0x98ee,  0x92c3,  0x8c8a,  0x8647,
+	 0x8000,  0x79b8,  0x7375,  0x6d3c,  0x6711,  0x60f9,  0x5afa,  0x5516,
+	 0x4f53,  0x49b4,  0x443f,  0x3ef5,  0x39dc,  0x34f7,  0x3048,  0x2bd2,
+	 0x2799,  0x239e,  0x1fe2,  0x1c69,  0x1933,  0x1641,  0x1394,  0x112d,
+	 0x0f0a,  0x0d2d,  0x0b94,  0x0a3e,  0x092b,  0x0859,  0x07c5,  0x076e,
+	 0x0752,  0x076d,  0x07be,  0x0840,  0x08f1,  0x09cd,  0x0ad1,  0x0bf8,
+	 0x0d3f,  0x0ea3,  0x101e,  0x11ad,  0x134c,  0x14f6,  0x16a8,  0x185d,
+	 0x1a12,  0x1bc3,  0x1d6b,  0x1f07,  0x2094,  0x220e,  0x2373,  0x24bf,
+	 0x25ef,  0x2702,  0x27f4,  0x28c5,  0x2972,  0x29fa,  0x2a5c,  0x2a97,
+	 0x2aaa,  0x2a97,  0x2a5c,  0x29fa,  0x2972,  0x28c5,  0x27f4,  0x2702,
+	 0x25ef,  0x24bf,  0x2373,  0x220e,  0x2094,  0x1f07,  0x1d6b,  0x1bc3,
+	 0x1a12,  0x185d,  0x16a8,  0x14f6,  0x134c,  0x11ad,  0x101e,  0x0ea3,
+	 0x0d3f,  0x0bf8,  0x0ad1,  0x09cd,  0x08f1,  0x0840,  0x07be,  0x076d,
+	 0x0752,  0x076e,  0x07c5,  0x0859,  0x092b,  0x0a3e,  0x0b94,  0x0d2d,
+	 0x0f0a,  0x112d,  0x1394,  0x1641,  0x1933,  0x1c69,  0x1fe2,  0x239e,
+	 0x2799,  0x2bd2,  0x3048,  0x34f7,  0x39dc,  0x3ef5,  0x443f,  0x49b4,
+	 0x4f53,  0x5516,  0x5afa,  0x60f9,  0x6711,  0x6d3c,  0x7375,  0x79b8,
+	 0x8000,  0x8324,  0x8647,  0x896a,  0x8c8b,  0x8fab,  0x92c7,  0x95e1,
+	 0x98f8,  0x9c0b,  0x9f19,  0xa223,  0xa527,  0xa826,  0xab1f,  0xae10,
+	 0xb0fb,  0xb3de,  0xb6b9,  0xb98c,  0xbc56,  0xbf17,  0xc1cd,  0xc47a,
+	 0xc71c,  0xc9b3,  0xcc3f,  0xcebf,  0xd133,  0xd39a,  0xd5f5,  0xd842,
+	 0xda82,  0xdcb3,  0xded7,  0xe0eb,  0xe2f1,  0xe4e8,  0xe6cf,  0xe8a6,
+	 0xea6d,  0xec23,  0xedc9,  0xef5e,  0xf0e2,  0xf254,  0xf3b5,  0xf504,
+	 0xf641,  0xf76b,  0xf884,  0xf989,  0xfa7c,  0xfb5c,  0xfc29,  0xfce3,
+	 0xfd89,  0xfe1d,  0xfe9c,  0xff09,  0xff61,  0xffa6,  0xffd8,  0xfff5,
+	 0xffff,  0xfff5,  0xffd8,  0xffa6,  0xff61,  0xff09,  0xfe9c,  0xfe1d,
+	 0xfd89,  0xfce3,  0xfc29,  0xfb5c,  0xfa7c,  0xf989,  0xf884,  0xf76b,
+	 0xf641,  0xf504,  0xf3b5,  0xf254,  0xf0e2,  0xef5e,  0xedc9,  0xec23,
+	 0xea6d,  0xe8a6,  0xe6cf,  0xe4e8,  0xe2f1,  0xe0eb,  0xded7,  0xdcb3,
+	 0xda82,  0xd842,  0xd5f5,  0xd39a,  0xd133,  0xcebf,  0xcc3f,  0xc9b3,
+	 0xc71c,  0xc47a,  0xc1cd,  0xbf17,  0xbc56,  0xb98c,  0xb6b9,  0xb3de,
+	 0xb0fb,  0xae10,  0xab1f,  0xa826,  0xa527,  0xa223,  0x9f19,  0x9c0b,
+	 0x98f8,  0x95e1,  0x92c7,  0x8fab,  0x8c8b,  0x896a,  0x8647,  0x8324,
+	 0x8000,  0x7cdb,  0x79b8,  0x7695,  0x7374,  0x7054,  0x6d38,  0x6a1e,
+	 0x6707,  0x63f4,  0x60e6,  0x5ddc,  0x5ad8,  0x57d9,  0x54e0,  0x51ef,
+	 0x4f04,  0x4c21,  0x4946,  0x4673,  0x43a9,  0x40e8,  0x3e32,  0x3b85,
+	 0x38e3,  0x364c,  0x33c0,  0x3140,  0x2ecc,  0x2c65,  0x2a0a,  0x27bd,
+	 0x257d,  0x234c,  0x2128,  0x1f14,  0x1d0e,  0x1b17,  0x1930,  0x1759,
+	 0x1592,  0x13dc,  0x1236,  0x10a1,  0x0f1d,  0x0dab,  0x0c4a,  0x0afb,
+	 0x09be,  0x0894,  0x077b,  0x0676,  0x0583,  0x04a3,  0x03d6,  0x031c,
+	 0x0276,  0x01e2,  0x0163,  0x00f6,  0x009e,  0x0059,  0x0027,  0x000a,
+	 0x0000,  0x000a,  0x0027,  0x0059,  0x009e,  0x00f6,  0x0163,  0x01e2,
+	 0x0276,  0x031c,  0x03d6,  0x04a3,  0x0583,  0x0676,  0x077b,  0x0894,
+	 0x09be,  0x0afb,  0x0c4a,  0x0dab,  0x0f1d,  0x10a1,  0x1236,  0x13dc,
+	 0x1592,  0x1759,  0x1930,  0x1b17,  0x1d0e,  0x1f14,  0x2128,  0x234c,
+	 0x257d,  0x27bd,  0x2a0a,  0x2c65,  0x2ecc,  0x3140,  0x33c0,  0x364c,
+	 0x38e3,  0x3b85,  0x3e32,  0x40e8,  0x43a9,  0x4673,  0x4946,  0x4c21,
+	 0x4f04,  0x51ef,  0x54e0,  0x57d9,  0x5ad8,  0x5ddc,  0x60e6,  0x63f4,
+	 0x6707,  0x6a1e,  0x6d38,  0x7054,  0x7374,  0x7695,  0x79b8,  0x7cdb,
+	 0x8000,  0x8324,  0x8647,  0x896a,  0x8c8b,  0x8fab,  0x92c7,  0x95e1,
+	 0x98f8,  0x9c0b,  0x9f19,  0xa223,  0xa527,  0xa826,  0xab1f,  0xae10,
+	 0xb0fb,  0xb3de,  0xb6b9,  0xb98c,  0xbc56,  0xbf17,  0xc1cd,  0xc47a,
+	 0xc71c,  0xc9b3,  0xcc3f,  0xcebf,  0xd133,  0xd39a,  0xd5f5,  0xd842,
+	 0xda82,  0xdcb3,  0xded7,  0xe0eb,  0xe2f1,  0xe4e8,  0xe6cf,  0xe8a6,
+	 0xea6d,  0xec23,  0xedc9,  0xef5e,  0xf0e2,  0xf254,  0xf3b5,  0xf504,
+	 0xf641,  0xf76b,  0xf884,  0xf989,  0xfa7c,  0xfb5c,  0xfc29,  0xfce3,
+	 0xfd89,  0xfe1d,  0xfe9c,  0xff09,  0xff61,  0xffa6,  0xffd8,  0xfff5,
+	 0xffff,  0xfff5,  0xffd8,  0xffa6,  0xff61,  0xff09,  0xfe9c,  0xfe1d,
+	 0xfd89,  0xfce3,  0xfc29,  0xfb5c,  0xfa7c,  0xf989,  0xf884,  0xf76b,
+	 0xf641,  0xf504,  0xf3b5,  0xf254,  0xf0e2,  0xef5e,  0xedc9,  0xec23,
+	 0xea6d,  0xe8a6,  0xe6cf,  0xe4e8,  0xe2f1,  0xe0eb,  0xded7,  0xdcb3,
+	 0xda82,  0xd842,  0xd5f5,  0xd39a,  0xd133,  0xcebf,  0xcc3f,  0xc9b3,
+	 0xc71c,  0xc47a,  0xc1cd,  0xbf17,  0xbc56,  0xb98c,  0xb6b9,  0xb3de,
+	 0xb0fb,  0xae10,  0xab1f,  0xa826,  0xa527,  0xa223,  0x9f19,  0x9c0b,
+	 0x98f8,  0x95e1,  0x92c7,  0x8fab,  0x8c8b,  0x896a,  0x8647,  0x8324,
+	 0x8000,  0x7cdb,  0x79b8,  0x7695,  0x7374,  0x7054,  0x6d38,  0x6a1e,
+	 0x6707,  0x63f4,  0x60e6,  0x5ddc,  0x5ad8,  0x57d9,  0x54e0,  0x51ef,
+	 0x4f04,  0x4c21,  0x4946,  0x4673,  0x43a9,  0x40e8,  0x3e32,  0x3b85,
+	 0x38e3,  0x364c,  0x33c0,  0x3140,  0x2ecc,  0x2c65,  0x2a0a,  0x27bd,
+	 0x257d,  0x234c,  0x2128,  0x1f14,  0x1d0e,  0x1b17,  0x1930,  0x1759,
+	 0x1592,  0x13dc,  0x1236,  0x10a1,  0x0f1d,  0x0dab,  0x0c4a,  0x0afb,
+	 0x09be,  0x0894,  0x077b,  0x0676,  0x0583,  0x04a3,  0x03d6,  0x031c,
+	 0x0276,  0x01e2,  0x0163,  0x00f6,  0x009e,  0x0059,  0x0027,  0x000a,
+	 0x0000,  0x000a,  0x0027,  0x0059,  0x009e,  0x00f6,  0x0163,  0x01e2,
+	 0x0276,  0x031c,  0x03d6,  0x04a3,  0x0583,  0x0676,  0x077b,  0x0894,
+	 0x09be,  0x0afb,  0x0c4a,  0x0dab,  0x0f1d,  0x10a1,  0x1236,  0x13dc,
+	 0x1592,  0x1759,  0x1930,  0x1b17,  0x1d0e,  0x1f14,  0x2128,  0x234c,
+	 0x257d,  0x27bd,  0x2a0a,  0x2c65,  0x2ecc,  0x3140,  0x33c0,  0x364c,
+	 0x38e3,  0x3b85,  0x3e32,  0x40e8,  0x43a9,  0x4673,  0x4946,  0x4c21,
+	 0x4f04,  0x51ef,  0x54e0,  0x57d9,  0x5ad8,  0x5ddc,  0x60e6,  0x63f4,
+	 0x6707,  0x6a1e,  0x6d38,  0x7054,  0x7374,  0x7695,  0x79b8,  0x7cdb
+};
+#endif
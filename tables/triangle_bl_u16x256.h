@@ -0,0 +1,261 @@
+#ifndef TRIANGLE_BL_U16X256_H
+#define TRIANGLE_BL_U16X256_H
+const uint16_t triangle_bl_u16x256[] PROGMEM = {
+	 0x8000,  0x8201,  0x8403,  0x8604,  0x8806,  0x8a08,  0x8c09,  0x8e0b,
+	 0x900c,  0x920e,  0x9410,  0x9611,  0x9813,  0x9a15,  0x9c16,  0x9e18,
+	 0xa019,  0xa21b,  0xa41d,  0xa61e,  0xa820,  0xaa21,  0xac23,  0xae25,
+	 0xb026,  0xb228,  0xb42a,  0xb62b,  0xb82d,  0xba2e,  0xbc30,  0xbe32,
+	 0xc033,  0xc235,  0xc437,  0xc638,  0xc83a,  0xca3b,  0xcc3d,  0xce3f,
+	 0xd040,  0xd242,  0xd443,  0xd645,  0xd847,  0xda48,  0xdc4a,  0xde4c,
+	 0xe04d,  0xe24f,  0xe450,  0xe652,  0xe854,  0xea55,  0xec57,  0xee59,
+	 0xf05a,  0xf25c,  0xf45d,  0xf660,  0xf85f,  0xfa64,  0xfc60,  0xfe72,
+	 0xffff,  0xfe72,  0xfc60,  0xfa64,  0xf85f,  0xf660,  0xf45d,  0xf25c,
+	 0xf05a,  0xee59,  0xec57,  0xea55,  0xe854,  0xe652,  0xe450,  0xe24f,
+	 0xe04d,  0xde4c,  0xdc4a,  0xda48,  0xd847,  0xd645,  0xd443,  0xd242,
+	 0xd040,  0xce3f,  0xcc3d,  0xca3b,  0xc83a,  0xc638,  0xc437,  0xc235,
+	 0xc033,  0xbe32,  0xbc30,  0xba2e,  0xb82d,  0xb62b,  0xb42a,  0xb228,
+	 0xb026,  0xae25,  0xac23,  0xaa21,  0xa820,  0xa61e,  0xa41d,  0xa21b,
+	 0xa019,  0x9e18,  0x9c16,  0x9a15,  0x9813,  0x9611,  0x9410,  0x920e,
+	 0x900c,  0x8e0b,  0x8c09,  0x8a08,  0x8806,  0x8604,  0x8403,  0x8201,
+	 0x8000,  0x7dfe,  0x7bfc,  0x79fb,  0x77f9,  0x75f7,  0x73f6,  0x71f4,
+	 0x6ff3,  0x6df1,  0x6bef,  0x69ee,  0x67ec,  0x65ea,  0x63e9,  0x61e7,
+	 0x5fe6,  0x5de4,  0x5be2,  0x59e1,  0x57df,  0x55de,  0x53dc,  0x51da,
+	 0x4fd9,  0x4dd7,  0x4bd5,  0x49d4,  0x47d2,  0x45d1,  0x43cf,  0x41cd,
+	 0x3fcc,  0x3dca,  0x3bc8,  0x39c7,  0x37c5,  0x35c4,  0x33c2,  0x31c0,
+	 0x2fbf,  0x2dbd,  0x2bbc,  0x29ba,  0x27b8,  0x25b7,  0x23b5,  0x21b3,
+	 0x1fb2,  0x1db0,  0x1baf,  0x19ad,  0x17ab,  0x15aa,  0x13a8,  0x11a6,
+	 0x0fa5,  0x0da3,  0x0ba2,  0x099f,  0x07a0,  0x059b,  0x039f,  0x018d,
+	 0x0000,  0x018d,  0x039f,  0x059b,  0x07a0,  0x099f,  0x0ba2,  0x0da3,
+	 0x0fa5,  0x11a6,  0x13a8,  0x15aa,  0x17ab,  0x19ad,  0x1baf,  0x1db0,
+	 0x1fb2,  0x21b3,  0x23b5,  0x25b7,  0x27b8,  0x29ba,  0x2bbc,  0x2dbd,
+	 0x2fbf,  0x31c0,  0x33c2,  0x35c4,  0x37c5,  0x39c7,  0x3bc8,  0x3dca,
+	 0x3fcc,  0x41cd,  0x43cf,  0x45d1,  0x47d2,  0x49d4,  0x4bd5,  0x4dd7,
+	 0x4fd9,  0x51da,  0x53dc,  0x55de,  0x57df,  0x59e1,  0x5be2,  0x5de4,
+	 0x5fe6,  0x61e7,  0x63e9,  0x65ea,  0x67ec,  0x69ee,  0x6bef,  0x6df1,
+	 0x6ff3,  0x71f4,  0x73f6,  0x75f7,  0x77f9,  0x79fb,  0x7bfc,  0x7dfe,
+	 0x8000,  0x81fe,  0x8403,  0x8608,  0x8806,  0x8a04,  0x8c09,  0x8e0e,
+	 0x900c,  0x920b,  0x9410,  0x9615,  0x9813,  0x9a11,  0x9c16,  0x9e1b,
+	 0xa019,  0xa217,  0xa41d,  0xa622,  0xa820,  0xaa1e,  0xac23,  0xae29,
+	 0xb026,  0xb224,  0xb42a,  0xb62f,  0xb82d,  0xba2a,  0xbc30,  0xbe36,
+	 0xc033,  0xc230,  0xc437,  0xc63d,  0xc83a,  0xca36,  0xcc3d,  0xce44,
+	 0xd040,  0xd23c,  0xd444,  0xd64c,  0xd846,  0xda41,  0xdc4a,  0xde54,
+	 0xe04d,  0xe246,  0xe451,  0xe65c,  0xe853,  0xea49,  0xec58,  0xee67,
+	 0xf058,  0xf24a,  0xf462,  0xf678,  0xf858,  0xfa3d,  0xfc7c,  0xfea7,
+	 0xff97,  0xfea7,  0xfc7c,  0xfa3d,  0xf858,  0xf678,  0xf462,  0xf24a,
+	 0xf058,  0xee67,  0xec58,  0xea49,  0xe853,  0xe65c,  0xe451,  0xe246,
+	 0xe04d,  0xde54,  0xdc4a,  0xda41,  0xd846,  0xd64c,  0xd444,  0xd23c,
+	 0xd040,  0xce44,  0xcc3d,  0xca36,  0xc83a,  0xc63d,  0xc437,  0xc230,
+	 0xc033,  0xbe36,  0xbc30,  0xba2a,  0xb82d,  0xb62f,  0xb42a,  0xb224,
+	 0xb026,  0xae29,  0xac23,  0xaa1e,  0xa820,  0xa622,  0xa41d,  0xa217,
+	 0xa019,  0x9e1b,  0x9c16,  0x9a11,  0x9813,  0x9615,  0x9410,  0x920b,
+	 0x900c,  0x8e0e,  0x8c09,  0x8a04,  0x8806,  0x8608,  0x8403,  0x81fe,
+	 0x8000,  0x7e01,  0x7bfc,  0x79f7,  0x77f9,  0x75fb,  0x73f6,  0x71f1,
+	 0x6ff3,  0x6df4,  0x6bef,  0x69ea,  0x67ec,  0x65ee,  0x63e9,  0x61e4,
+	 0x5fe6,  0x5de8,  0x5be2,  0x59dd,  0x57df,  0x55e1,  0x53dc,  0x51d6,
+	 0x4fd9,  0x4ddb,  0x4bd5,  0x49d0,  0x47d2,  0x45d5,  0x43cf,  0x41c9,
+	 0x3fcc,  0x3dcf,  0x3bc8,  0x39c2,  0x37c5,  0x35c9,  0x33c2,  0x31bb,
+	 0x2fbf,  0x2dc3,  0x2bbb,  0x29b3,  0x27b9,  0x25be,  0x23b5,  0x21ab,
+	 0x1fb2,  0x1db9,  0x1bae,  0x19a3,  0x17ac,  0x15b6,  0x13a7,  0x1198,
+	 0x0fa7,  0x0db5,  0x0b9d,  0x0987,  0x07a7,  0x05c2,  0x0383,  0x0158,
+	 0x0068,  0x0158,  0x0383,  0x05c2,  0x07a7,  0x0987,  0x0b9d,  0x0db5,
+	 0x0fa7,  0x1198,  0x13a7,  0x15b6,  0x17ac,  0x19a3,  0x1bae,  0x1db9,
+	 0x1fb2,  0x21ab,  0x23b5,  0x25be,  0x27b9,  0x29b3,  0x2bbb,  0x2dc3,
+	 0x2fbf,  0x31bb,  0x33c2,  0x35c9,  0x37c5,  0x39c2,  0x3bc8,  0x3dcf,
+	 0x3fcc,  0x41c9,  0x43cf,  0x45d5,  0x47d2,  0x49d0,  0x4bd5,  0x4ddb,
+	 0x4fd9,  0x51d6,  0x53dc,  0x55e1,  0x57df,  0x59dd,  0x5be2,  0x5de8,
+	 0x5fe6,  0x61e4,  0x63e9,  0x65ee,  0x67ec,  0x69ea,  0x6bef,  0x6df4,
+	 0x6ff3,  0x71f1,  0x73f6,  0x75fb,  0x77f9,  0x79f7,  0x7bfc,  0x7e01,
+	 0x8000,  0x81f8,  0x83f6,  0x85fb,  0x8806,  0x8a11,  0x8c16,  0x8e14,
+	 0x900c,  0x9205,  0x9402,  0x9608,  0x9813,  0x9a1e,  0x9c24,  0x9e21,
+	 0xa019,  0xa211,  0xa40e,  0xa614,  0xa820,  0xaa2c,  0xac32,  0xae2f,
+	 0xb026,  0xb21c,  0xb419,  0xb620,  0xb82e,  0xba3b,  0xbc41,  0xbe3e,
+	 0xc032,  0xc227,  0xc423,  0xc62b,  0xc83b,  0xca4b,  0xcc53,  0xce4d,
+	 0xd03e,  0xd22f,  0xd42b,  0xd635,  0xd84a,  0xda5f,  0xdc68,  0xde5f,
+	 0xe048,  0xe232,  0xe42b,  0xe63b,  0xe85c,  0xea7c,  0xec88,  0xee75,
+	 0xf049,  0xf21e,  0xf413,  0xf63d,  0xf891,  0xfae3,  0xfce7,  0xfe49,
+	 0xfec7,  0xfe49,  0xfce7,  0xfae3,  0xf891,  0xf63d,  0xf413,  0xf21e,
+	 0xf049,  0xee75,  0xec88,  0xea7c,  0xe85c,  0xe63b,  0xe42b,  0xe232,
+	 0xe048,  0xde5f,  0xdc68,  0xda5f,  0xd84a,  0xd635,  0xd42b,  0xd22f,
+	 0xd03e,  0xce4d,  0xcc53,  0xca4b,  0xc83b,  0xc62b,  0xc423,  0xc227,
+	 0xc032,  0xbe3e,  0xbc41,  0xba3b,  0xb82e,  0xb620,  0xb419,  0xb21c,
+	 0xb026,  0xae2f,  0xac32,  0xaa2c,  0xa820,  0xa614,  0xa40e,  0xa211,
+	 0xa019,  0x9e21,  0x9c24,  0x9a1e,  0x9813,  0x9608,  0x9402,  0x9205,
+	 0x900c,  0x8e14,  0x8c16,  0x8a11,  0x8806,  0x85fb,  0x83f6,  0x81f8,
+	 0x8000,  0x7e07,  0x7c09,  0x7a04,  0x77f9,  0x75ee,  0x73e9,  0x71eb,
+	 0x6ff3,  0x6dfa,  0x6bfd,  0x69f7,  0x67ec,  0x65e1,  0x63db,  0x61de,
+	 0x5fe6,  0x5dee,  0x5bf1,  0x59eb,  0x57df,  0x55d3,  0x53cd,  0x51d0,
+	 0x4fd9,  0x4de3,  0x4be6,  0x49df,  0x47d1,  0x45c4,  0x43be,  0x41c1,
+	 0x3fcd,  0x3dd8,  0x3bdc,  0x39d4,  0x37c4,  0x35b4,  0x33ac,  0x31b2,
+	 0x2fc1,  0x2dd0,  0x2bd4,  0x29ca,  0x27b5,  0x25a0,  0x2397,  0x21a0,
+	 0x1fb7,  0x1dcd,  0x1bd4,  0x19c4,  0x17a3,  0x1583,  0x1377,  0x118a,
+	 0x0fb6,  0x0de1,  0x0bec,  0x09c2,  0x076e,  0x051c,  0x0318,  0x01b6,
+	 0x0138,  0x01b6,  0x0318,  0x051c,  0x076e,  0x09c2,  0x0bec,  0x0de1,
+	 0x0fb6,  0x118a,  0x1377,  0x1583,  0x17a3,  0x19c4,  0x1bd4,  0x1dcd,
+	 0x1fb7,  0x21a0,  0x2397,  0x25a0,  0x27b5,  0x29ca,  0x2bd4,  0x2dd0,
+	 0x2fc1,  0x31b2,  0x33ac,  0x35b4,  0x37c4,  0x39d4,  0x3bdc,  0x3dd8,
+	 0x3fcd,  0x41c1,  0x43be,  0x45c4,  0x47d1,  0x49df,  0x4be6,  0x4de3,
+	 0x4fd9,  0x51d0,  0x53cd,  0x55d3,  0x57df,  0x59eb,  0x5bf1,  0x5dee,
+	 0x5fe6,  0x61de,  0x63db,  0x65e1,  0x67ec,  0x69f7,  0x6bfd,  0x6dfa,
+	 0x6ff3,  0x71eb,  0x73e9,  0x75ee,  0x77f9,  0x7a04,  0x7c09,  0x7e07,
+	 0x8000,  0x81ed,  0x83de,  0x85d5,  0x87d2,  0x89d8,  0x8be5,  0x8df8,
+	 0x900e,  0x9224,  0x9436,  0x9643,  0x9849,  0x9a46,  0x9c3b,  0x9e2a,
+	 0xa017,  0xa203,  0xa3f2,  0xa5e8,  0xa7e6,  0xa9ed,  0xabfc,  0xae12,
+	 0xb02b,  0xb245,  0xb45a,  0xb669,  0xb86e,  0xba6a,  0xbc5b,  0xbe45,
+	 0xc02b,  0xc211,  0xc3fb,  0xc5ed,  0xc7eb,  0xc9f5,  0xcc0b,  0xce2b,
+	 0xd050,  0xd275,  0xd494,  0xd6a8,  0xd8ad,  0xdaa1,  0xdc85,  0xde5d,
+	 0xe02c,  0xe1fc,  0xe3d4,  0xe5bd,  0xe7be,  0xe9d9,  0xec10,  0xee5f,
+	 0xf0ba,  0xf316,  0xf55f,  0xf781,  0xf967,  0xfafb,  0xfc2b,  0xfce8,
+	 0xfd28,  0xfce8,  0xfc2b,  0xfafb,  0xf967,  0xf781,  0xf55f,  0xf316,
+	 0xf0ba,  0xee5f,  0xec10,  0xe9d9,  0xe7be,  0xe5bd,  0xe3d4,  0xe1fc,
+	 0xe02c,  0xde5d,  0xdc85,  0xdaa1,  0xd8ad,  0xd6a8,  0xd494,  0xd275,
+	 0xd050,  0xce2b,  0xcc0b,  0xc9f5,  0xc7eb,  0xc5ed,  0xc3fb,  0xc211,
+	 0xc02b,  0xbe45,  0xbc5b,  0xba6a,  0xb86e,  0xb669,  0xb45a,  0xb245,
+	 0xb02b,  0xae12,  0xabfc,  0xa9ed,  0xa7e6,  0xa5e8,  0xa3f2,  0xa203,
+	 0xa017,  0x9e2a,  0x9c3b,  0x9a46,  0x9849,  0x9643,  0x9436,  0x9224,
+	 0x900e,  0x8df8,  0x8be5,  0x89d8,  0x87d2,  0x85d5,  0x83de,  0x81ed,
+	 0x8000,  0x7e12,  0x7c21,  0x7a2a,  0x782d,  0x7627,  0x741a,  0x7207,
+	 0x6ff1,  0x6ddb,  0x6bc9,  0x69bc,  0x67b6,  0x65b9,  0x63c4,  0x61d5,
+	 0x5fe8,  0x5dfc,  0x5c0d,  0x5a17,  0x5819,  0x5612,  0x5403,  0x51ed,
+	 0x4fd4,  0x4dba,  0x4ba5,  0x4996,  0x4791,  0x4595,  0x43a4,  0x41ba,
+	 0x3fd4,  0x3dee,  0x3c04,  0x3a12,  0x3814,  0x360a,  0x33f4,  0x31d4,
+	 0x2faf,  0x2d8a,  0x2b6b,  0x2957,  0x2752,  0x255e,  0x237a,  0x21a2,
+	 0x1fd3,  0x1e03,  0x1c2b,  0x1a42,  0x1841,  0x1626,  0x13ef,  0x11a0,
+	 0x0f45,  0x0ce9,  0x0aa0,  0x087e,  0x0698,  0x0504,  0x03d4,  0x0317,
+	 0x02d7,  0x0317,  0x03d4,  0x0504,  0x0698,  0x087e,  0x0aa0,  0x0ce9,
+	 0x0f45,  0x11a0,  0x13ef,  0x1626,  0x1841,  0x1a42,  0x1c2b,  0x1e03,
+	 0x1fd3,  0x21a2,  0x237a,  0x255e,  0x2752,  0x2957,  0x2b6b,  0x2d8a,
+	 0x2faf,  0x31d4,  0x33f4,  0x360a,  0x3814,  0x3a12,  0x3c04,  0x3dee,
+	 0x3fd4,  0x41ba,  0x43a4,  0x4595,  0x4791,  0x4996,  0x4ba5,  0x4dba,
+	 0x4fd4,  0x51ed,  0x5403,  0x5612,  0x5819,  0x5a17,  0x5c0d,  0x5dfc,
+	 0x5fe8,  0x61d5,  0x63c4,  0x65b9,  0x67b6,  0x69bc,  0x6bc9,  0x6ddb,
+	 0x6ff1,  0x7207,  0x741a,  0x7627,  0x782d,  0x7a2a,  0x7c21,  0x7e12,
+	 0x8000,  0x81d9,  0x83b4,  0x8593,  0x8775,  0x895e,  0x8b4d,  0x8d43,
+	 0x8f42,  0x9148,  0x9357,  0x956d,  0x978b,  0x99ae,  0x9bd6,  0x9e01,
+	 0xa02d,  0xa25a,  0xa485,  0xa6ad,  0xa8cf,  0xaaec,  0xad00,  0xaf0c,
+	 0xb10f,  0xb308,  0xb4f7,  0xb6de,  0xb8bc,  0xba92,  0xbc63,  0xbe2f,
+	 0xbffa,  0xc1c4,  0xc391,  0xc562,  0xc73a,  0xc91b,  0xcb07,  0xccff,
+	 0xcf05,  0xd119,  0xd33c,  0xd56d,  0xd7ac,  0xd9f7,  0xdc4b,  0xdea7,
+	 0xe107,  0xe366,  0xe5c1,  0xe813,  0xea57,  0xec87,  0xee9f,  0xf097,
+	 0xf26c,  0xf418,  0xf595,  0xf6e1,  0xf7f5,  0xf8d0,  0xf96e,  0xf9ce,
+	 0xf9ee,  0xf9ce,  0xf96e,  0xf8d0,  0xf7f5,  0xf6e1,  0xf595,  0xf418,
+	 0xf26c,  0xf097,  0xee9f,  0xec87,  0xea57,  0xe813,  0xe5c1,  0xe366,
+	 0xe107,  0xdea7,  0xdc4b,  0xd9f7,  0xd7ac,  0xd56d,  0xd33c,  0xd119,
+	 0xcf05,  0xccff,  0xcb07,  0xc91b,  0xc73a,  0xc562,  0xc391,  0xc1c4,
+	 0xbffa,  0xbe2f,  0xbc63,  0xba92,  0xb8bc,  0xb6de,  0xb4f7,  0xb308,
+	 0xb10f,  0xaf0c,  0xad00,  0xaaec,  0xa8cf,  0xa6ad,  0xa485,  0xa25a,
+	 0xa02d,  0x9e01,  0x9bd6,  0x99ae,  0x978b,  0x956d,  0x9357,  0x9148,
+	 0x8f42,  0x8d43,  0x8b4d,  0x895e,  0x8775,  0x8593,  0x83b4,  0x81d9,
+	 0x8000,  0x7e26,  0x7c4b,  0x7a6c,  0x788a,  0x76a1,  0x74b2,  0x72bc,
+	 0x70bd,  0x6eb7,  0x6ca8,  0x6a92,  0x6874,  0x6651,  0x6429,  0x61fe,
+	 0x5fd2,  0x5da5,  0x5b7a,  0x5952,  0x5730,  0x5513,  0x52ff,  0x50f3,
+	 0x4ef0,  0x4cf7,  0x4b08,  0x4921,  0x4743,  0x456d,  0x439c,  0x41d0,
+	 0x4005,  0x3e3b,  0x3c6e,  0x3a9d,  0x38c5,  0x36e4,  0x34f8,  0x3300,
+	 0x30fa,  0x2ee6,  0x2cc3,  0x2a92,  0x2853,  0x2608,  0x23b4,  0x2158,
+	 0x1ef8,  0x1c99,  0x1a3e,  0x17ec,  0x15a8,  0x1378,  0x1160,  0x0f68,
+	 0x0d93,  0x0be7,  0x0a6a,  0x091e,  0x080a,  0x072f,  0x0691,  0x0631,
+	 0x0611,  0x0631,  0x0691,  0x072f,  0x080a,  0x091e,  0x0a6a,  0x0be7,
+	 0x0d93,  0x0f68,  0x1160,  0x1378,  0x15a8,  0x17ec,  0x1a3e,  0x1c99,
+	 0x1ef8,  0x2158,  0x23b4,  0x2608,  0x2853,  0x2a92,  0x2cc3,  0x2ee6,
+	 0x30fa,  0x3300,  0x34f8,  0x36e4,  0x38c5,  0x3a9d,  0x3c6e,  0x3e3b,
+	 0x4005,  0x41d0,  0x439c,  0x456d,  0x4743,  0x4921,  0x4b08,  0x4cf7,
+	 0x4ef0,  0x50f3,  0x52ff,  0x5513,  0x5730,  0x5952,  0x5b7a,  0x5da5,
+	 0x5fd2,  0x61fe,  0x6429,  0x6651,  0x6874,  0x6a92,  0x6ca8,  0x6eb7,
+	 0x70bd,  0x72bc,  0x74b2,  0x76a1,  0x788a,  0x7a6c,  0x7c4b,  0x7e26,
+	 0x8000,  0x81b4,  0x8368,  0x851f,  0x86d8,  0x8894,  0x8a53,  0x8c17,
+	 0x8de1,  0x8fb0,  0x9185,  0x9362,  0x9546,  0x9731,  0x9925,  0x9b20,
+	 0x9d25,  0x9f32,  0xa148,  0xa366,  0xa58d,  0xa7bd,  0xa9f5,  0xac34,
+	 0xae7b,  0xb0c8,  0xb31c,  0xb576,  0xb7d4,  0xba36,  0xbc9b,  0xbf02,
+	 0xc16b,  0xc3d3,  0xc63a,  0xc89f,  0xcb01,  0xcd5d,  0xcfb3,  0xd202,
+	 0xd448,  0xd684,  0xd8b4,  0xdad7,  0xdcec,  0xdef1,  0xe0e5,  0xe2c7,
+	 0xe495,  0xe64e,  0xe7f1,  0xe97c,  0xeaef,  0xec48,  0xed87,  0xeeab,
+	 0xefb2,  0xf09c,  0xf168,  0xf216,  0xf2a5,  0xf315,  0xf365,  0xf395,
+	 0xf3a5,  0xf395,  0xf365,  0xf315,  0xf2a5,  0xf216,  0xf168,  0xf09c,
+	 0xefb2,  0xeeab,  0xed87,  0xec48,  0xeaef,  0xe97c,  0xe7f1,  0xe64e,
+	 0xe495,  0xe2c7,  0xe0e5,  0xdef1,  0xdcec,  0xdad7,  0xd8b4,  0xd684,
+	 0xd448,  0xd202,  0xcfb3,  0xcd5d,  0xcb01,  0xc89f,  0xc63a,  0xc3d3,
+	 0xc16b,  0xbf02,  0xbc9b,  0xba36,  0xb7d4,  0xb576,  0xb31c,  0xb0c8,
+	 0xae7b,  0xac34,  0xa9f5,  0xa7bd,  0xa58d,  0xa366,  0xa148,  0x9f32,
+	 0x9d25,  0x9b20,  0x9925,  0x9731,  0x9546,  0x9362,  0x9185,  0x8fb0,
+	 0x8de1,  0x8c17,  0x8a53,  0x8894,  0x86d8,  0x851f,  0x8368,  0x81b4,
+	 0x8000,  0x7e4b,  0x7c97,  0x7ae0,  0x7927,  0x776b,  0x75ac,  0x73e8,
+	 0x721e,  0x704f,  0x6e7a,  0x6c9d,  0x6ab9,  0x68ce,  0x66da,  0x64df,
+	 0x62da,  0x60cd,  0x5eb7,  0x5c99,  0x5a72,  0x5842,  0x560a,  0x53cb,
+	 0x5184,  0x4f37,  0x4ce3,  0x4a89,  0x482b,  0x45c9,  0x4364,  0x40fd,
+	 0x3e94,  0x3c2c,  0x39c5,  0x3760,  0x34fe,  0x32a2,  0x304c,  0x2dfd,
+	 0x2bb7,  0x297b,  0x274b,  0x2528,  0x2313,  0x210e,  0x1f1a,  0x1d38,
+	 0x1b6a,  0x19b1,  0x180e,  0x1683,  0x1510,  0x13b7,  0x1278,  0x1154,
+	 0x104d,  0x0f63,  0x0e97,  0x0de9,  0x0d5a,  0x0cea,  0x0c9a,  0x0c6a,
+	 0x0c5a,  0x0c6a,  0x0c9a,  0x0cea,  0x0d5a,  0x0de9,  0x0e97,  0x0f63,
+	 0x104d,  0x1154,  0x1278,  0x13b7,  0x1510,  0x1683,  0x180e,  0x19b1,
+	 0x1b6a,  0x1d38,  0x1f1a,  0x210e,  0x2313,  0x2528,  0x274b,  0x297b,
+	 0x2bb7,  0x2dfd,  0x304c,  0x32a2,  0x34fe,  0x3760,  0x39c5,  0x3c2c,
+	 0x3e94,  0x40fd,  0x4364,  0x45c9,  0x482b,  0x4a89,  0x4ce3,  0x4f37,
+	 0x5184,  0x53cb,  0x560a,  0x5842,  0x5a72,  0x5c99,  0x5eb7,  0x60cd,
+	 0x62da,  0x64df,  0x66da,  0x68ce,  0x6ab9,  0x6c9d,  0x6e7a,  0x704f,
+	 0x721e,  0x73e8,  0x75ac,  0x776b,  0x7927,  0x7ae0,  0x7c97,  0x7e4b,
+	 0x8000,  0x828d,  0x851b,  0x87a8,  0x8a33,  0x8cbd,  0x8f45,  0x91cb,
+	 0x944e,  0x96cd,  0x994a,  0x9bc2,  0x9e36,  0xa0a5,  0xa310,  0xa575,
+	 0xa7d4,  0xaa2d,  0xac80,  0xaecb,  0xb110,  0xb34d,  0xb582,  0xb7ae,
+	 0xb9d3,  0xbbee,  0xbe00,  0xc008,  0xc207,  0xc3fb,  0xc5e5,  0xc7c4,
+	 0xc998,  0xcb61,  0xcd1e,  0xcecf,  0xd074,  0xd20d,  0xd399,  0xd518,
+	 0xd68a,  0xd7ee,  0xd945,  0xda8f,  0xdbca,  0xdcf7,  0xde16,  0xdf26,
+	 0xe028,  0xe11b,  0xe1ff,  0xe2d3,  0xe399,  0xe44f,  0xe4f6,  0xe58d,
+	 0xe614,  0xe68c,  0xe6f4,  0xe74c,  0xe794,  0xe7cc,  0xe7f4,  0xe80c,
+	 0xe814,  0xe80c,  0xe7f4,  0xe7cc,  0xe794,  0xe74c,  0xe6f4,  0xe68c,
+	 0xe614,  0xe58d,  0xe4f6,  0xe44f,  0xe399,  0xe2d3,  0xe1ff,  0xe11b,
+	 0xe028,  0xdf26,  0xde16,  0xdcf7,  0xdbca,  0xda8f,  0xd945,  0xd7ee,
+	 0xd68a,  0xd518,  0xd399,  0xd20d,  0xd074,  0xcecf,  0xcd1e,  0xcb61,
+	 0xc998,  0xc7c4,  0xc5e5,  0xc3fb,  0xc207,  0xc008,  0xbe00,  0xbbee,
+	 0xb9d3,  0xb7ae,  0xb582,  0xb34d,  0xb110,  0xaecb,  0xac80,  0xaa2d,
+	 0xa7d4,  0xa575,  0xa310,  0xa0a5,  0x9e36,  0x9bc2,  0x994a,  0x96cd,
+	 0x944e,  0x91cb,  0x8f45,  0x8cbd,  0x8a33,  0x87a8,  0x851b,  0x828d,
+	 0x8000,  0x7d72,  0x7ae4,  0x7857,  0x75cc,  0x7342,  0x70ba,  0x6e34,
+	 0x6bb1,  0x6932,  0x66b5,  0x643d,  0x61c9,  0x5f5a,  0x5cef,  0x5a8a,
+	 0x582b,  0x55d2,  0x537f,  0x5134,  0x4eef,  0x4cb2,  0x4a7d,  0x4851,
+	 0x462c,  0x4411,  0x41ff,  0x3ff7,  0x3df8,  0x3c04,  0x3a1a,  0x383b,
+	 0x3667,  0x349e,  0x32e1,  0x3130,  0x2f8b,  0x2df2,  0x2c66,  0x2ae7,
+	 0x2975,  0x2811,  0x26ba,  0x2570,  0x2435,  0x2308,  0x21e9,  0x20d9,
+	 0x1fd7,  0x1ee4,  0x1e00,  0x1d2c,  0x1c66,  0x1bb0,  0x1b09,  0x1a72,
+	 0x19eb,  0x1973,  0x190b,  0x18b3,  0x186b,  0x1833,  0x180b,  0x17f3,
+	 0x17eb,  0x17f3,  0x180b,  0x1833,  0x186b,  0x18b3,  0x190b,  0x1973,
+	 0x19eb,  0x1a72,  0x1b09,  0x1bb0,  0x1c66,  0x1d2c,  0x1e00,  0x1ee4,
+	 0x1fd7,  0x20d9,  0x21e9,  0x2308,  0x2435,  0x2570,  0x26ba,  0x2811,
+	 0x2975,  0x2ae7,  0x2c66,  0x2df2,  0x2f8b,  0x3130,  0x32e1,  0x349e,
+	 0x3667,  0x383b,  0x3a1a,  0x3c04,  0x3df8,  0x3ff7,  0x41ff,  0x4411,
+	 0x462c,  0x4851,  0x4a7d,  0x4cb2,  0x4eef,  0x5134,  0x537f,  0x55d2,
+	 0x582b,  0x5a8a,  0x5cef,  0x5f5a,  0x61c9,  0x643d,  0x66b5,  0x6932,
+	 0x6bb1,  0x6e34,  0x70ba,  0x7342,  0x75cc,  0x7857,  0x7ae4,  0x7d72,
+	 0x8000,  0x828d,  0x851b,  0x87a8,  0x8a33,  0x8cbd,  0x8f45,  0x91cb,
+	 0x944e,  0x96cd,  0x994a,  0x9bc2,  0x9e36,  0xa0a5,  0xa310,  0xa575,
+	 0xa7d4,  0xaa2d,  0xac80,  0xaecb,  0xb110,  0xb34d,  0xb582,  0xb7ae,
+	 0xb9d3,  0xbbee,  0xbe00,  0xc008,  0xc207,  0xc3fb,  0xc5e5,  0xc7c4,
+	 0xc998,  0xcb61,  0xcd1e,  0xcecf,  0xd074,  0xd20d,  0xd399,  0xd518,
+	 0xd68a,  0xd7ee,  0xd945,  0xda8f,  0xdbca,  0xdcf7,  0xde16,  0xdf26,
+	 0xe028,  0xe11b,  0xe1ff,  0xe2d3,  0xe399,  0xe44f,  0xe4f6,  0xe58d,
+	 0xe614,  0xe68c,  0xe6f4,  0xe74c,  0xe794,  0xe7cc,  0xe7f4,  0xe80c,
+	 0xe814,  0xe80c,  0xe7f4,  0xe7cc,  0xe794,  0xe74c,  0xe6f4,  0xe68c,
+	 0xe614,  0xe58d,  0xe4f6,  0xe44f,  0xe399,  0xe2d3,  0xe1ff,  0xe11b,
+	 0xe028,  0xdf26,  0xde16,  0xdcf7,  0xdbca,  0xda8f,  0xd945,  0xd7ee,
+	 0xd68a,  0xd518,  0xd399,  0xd20d,  0xd074,  0xcecf,  0xcd1e,  0xcb61,
+	 0xc998,  0xc7c4,  0xc5e5,  0xc3fb,  0xc207,  0xc008,  0xbe00,  0xbbee,
+	 0xb9d3,  0xb7ae,  0xb582,  0xb34d,  0xb110,  0xaecb,  0xac80,  0xaa2d,
+	 0xa7d4,  0xa575,  0xa310,  0xa0a5,  0x9e36,  0x9bc2,  0x994a,  0x96cd,
+	 0x944e,  0x91cb,  0x8f45,  0x8cbd,  0x8a33,  0x87a8,  0x851b,  0x828d,
+	 0x8000,  0x7d72,  0x7ae4,  0x7857,  0x75cc,  0x7342,  0x70ba,  0x6e34,
+	 0x6bb1,  0x6932,  0x66b5,  0x643d,  0x61c9,  0x5f5a,  0x5cef,  0x5a8a,
+	 0x582b,  0x55d2,  0x537f,  0x5134,  0x4eef,  0x4cb2,  0x4a7d,  0x4851,
+	 0x462c,  0x4411,  0x41ff,  0x3ff7,  0x3df8,  0x3c04,  0x3a1a,  0x383b,
+	 0x3667,  0x349e,  0x32e1,  0x3130,  0x2f8b,  0x2df2,  0x2c66,  0x2ae7,
+	 0x2975,  0x2811,  0x26ba,  0x2570,  0x2435,  0x2308,  0x21e9,  0x20d9,
+	 0x1fd7,  0x1ee4,  0x1e00,  0x1d2c,  0x1c66,  0x1bb0,  0x1b09,  0x1a72,
+	 0x19eb,  0x1973,  0x190b,  0x18b3,  0x186b,  0x1833,  0x180b,  0x17f3,
+	 0x17eb,  0x17f3,  0x180b,  0x1833,  0x186b,  0x18b3,  0x190b,  0x1973,
+	 0x19eb,  0x1a72,  0x1b09,  0x1bb0,  0x1c66,  0x1d2c,  0x1e00,  0x1ee4,
+	 0x1fd7,  0x20d9,  0x21e9,  0x2308,  0x2435,  0x2570,  0x26ba,  0x2811,
+	 0x2975,  0x2ae7,  0x2c66,  0x2df2,  0x2f8b,  0x3130,  0x32e1,  0x349e,
+	 0x3667,  0x383b,  0x3a1a,  0x3c04,  0x3df8,  0x3ff7,  0x41ff,  0x4411,
+	 0x462c,  0x4851,  0x4a7d,  0x4cb2,  0x4eef,  0x5134,  0x537f,  0x55d2,
+	 0x582b,  0x5a8a,  0x5cef,  0x5f5a,  0x61c9,  0x643d,  0x66b5,  0x6932,
+	 0x6bb1,  0x6e34,  0x70ba,  0x7342,  0x75cc,  0x7857,  0x7ae4,  0x7d72
+};
+#endif